@@ -0,0 +1,3 @@
+#!/bin/sh
+# Script to preload ESMF dynamic trace library
+env LD_PRELOAD="$LD_PRELOAD /root/repo/lib/libO/Linux.gfortran.64.openmpi.default/libesmftrace_preload.so" $*
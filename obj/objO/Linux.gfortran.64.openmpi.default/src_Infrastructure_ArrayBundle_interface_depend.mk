@@ -0,0 +1,138 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle_F.o : ESMCI_ArrayBundle.h
@@ -0,0 +1,69 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
@@ -0,0 +1,621 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayHa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o : ESMF_ArrayCreate.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o : ESMF_ArrayGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGather.o : ESMF_ArrayGather.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayScatter.o : ESMF_ArrayScatter.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array_F.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Array.o : ESMCI_Array.h ESMC_Array.h
@@ -0,0 +1,69 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Array.o : ESMCI_Array.h
@@ -0,0 +1,69 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute_F.o : ESMCI_Attribute.h
@@ -0,0 +1,552 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attribute.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeUpdate.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWrite.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIM.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteCIMgrids.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteTab.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteXML.o : ESMCI_Attribute.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_AttributeWriteJSON.o : ESMCI_Attribute.h
@@ -0,0 +1,207 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base_F.o : ESMCI_Base.h
@@ -0,0 +1,69 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
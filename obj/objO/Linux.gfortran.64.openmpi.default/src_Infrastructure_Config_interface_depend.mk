@@ -0,0 +1,138 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Config.o : ESMC_Config.h
@@ -0,0 +1,138 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Container_F.o : ESMCI_Container.h
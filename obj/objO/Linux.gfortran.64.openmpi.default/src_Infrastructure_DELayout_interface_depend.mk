@@ -0,0 +1,138 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout_F.o : ESMCI_DELayout.h
@@ -0,0 +1,69 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DELayout.o : ESMCI_DELayout.h
@@ -0,0 +1,345 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridConnection.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGridRegDecomp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid_F.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_DistGrid.o : ESMCI_DistGrid.h ESMC_DistGrid.h
@@ -0,0 +1,69 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o : ESMF_FieldBundle.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FactorRead.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
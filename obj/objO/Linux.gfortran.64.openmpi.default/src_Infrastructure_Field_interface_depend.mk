@@ -0,0 +1,276 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field_F.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Field.o : ESMCI_Field.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Field.o : ESMCI_Field.h ESMC_Field.h
@@ -0,0 +1,69 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
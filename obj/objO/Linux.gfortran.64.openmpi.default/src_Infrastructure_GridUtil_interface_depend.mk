@@ -0,0 +1,138 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridUtil_F.o : ESMCI_GridToMesh.h
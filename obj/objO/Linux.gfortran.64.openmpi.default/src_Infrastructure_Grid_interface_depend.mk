@@ -0,0 +1,345 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid_F.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Grid.o : ESMCI_Grid.h ESMC_Grid.h
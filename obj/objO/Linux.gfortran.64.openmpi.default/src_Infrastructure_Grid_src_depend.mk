@@ -0,0 +1,69 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Grid.o : ESMCI_Grid.h
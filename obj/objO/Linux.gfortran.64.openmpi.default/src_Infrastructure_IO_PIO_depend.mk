@@ -0,0 +1,2208 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/alloc_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ionf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iompi_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_nf_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdecomp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/calcdisplace_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_spmd_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_utils.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rearrange.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_mpi_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfread_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfwrite_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfget_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfput_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_getput_callbacks.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_msg_mod.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_support.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piolib_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/darray_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_kinds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piodarray.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nf_cpp_binding.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_cpp_utils.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pio_types.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/pionfatt_mod.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/topology.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/piocpp.o : pio.h pio_types.h
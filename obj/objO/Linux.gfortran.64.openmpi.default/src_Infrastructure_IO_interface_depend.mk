@@ -0,0 +1,1242 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NetCDF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridmosaic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOFileTypeCheck.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Gridspec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOGridspec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_Scrip_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_NCPutGet.o : ESMF_IO_NCPutGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML_F.o : ESMCI_IO_XML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF_F.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IOScrip2ESMF.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_F.o : ESMCI_IO.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML_F.o : ESMCI_IO_YAML.h
@@ -0,0 +1,690 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2ReadHandler.o : ESMCI_SAX2ReadHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SAX2WriteHandler.o : ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_XML.o : ESMCI_IO_XML.h ESMCI_SAX2ReadHandler.h ESMCI_SAX2WriteHandler.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_NetCDF.o : ESMCI_IO_NetCDF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO.o : ESMCI_IO.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Handler.o : ESMCI_IO_Handler.h ESMCI_PIO_Handler.h esmf_io_debug.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Gridspec.o : ESMCI_IO_Gridspec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_Scrip.o : ESMCI_IO_Scrip.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IO_YAML.o : ESMCI_IO_YAML.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PIO_Handler.o : ESMCI_PIO_Handler.h esmf_io_debug.h pio.h pio_types.h
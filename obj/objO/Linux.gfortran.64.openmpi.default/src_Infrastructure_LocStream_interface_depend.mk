@@ -0,0 +1,276 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocStream.o : ESMCI_LocStream.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LocStream.o : ESMCI_LocStream.h ESMC_LocStream.h
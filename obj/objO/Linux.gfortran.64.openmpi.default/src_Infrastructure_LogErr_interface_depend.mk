@@ -0,0 +1,276 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr_F.o : ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_LogErr.o : ESMCI_LogErr.h ESMC_LogErr.h
@@ -0,0 +1,129 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogAsync.h ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogAsync.o : ESMCI_LogAsync.h
@@ -0,0 +1,1173 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dcopy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ddot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dger.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dnrm2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/drot.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dscal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dswap.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrmv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/idamax.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgemm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrsm.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/daxpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2k.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsymv.o :  
@@ -0,0 +1,8349 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dbdsqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqrf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsa.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlascl.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaset.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlassq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/disnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlalsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtzrzf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabad.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamch.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ieeeck.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelq2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlabrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlamrg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarft.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelqf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlacpy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlange.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlartg.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormbr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iladlr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanst.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzb.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasd8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorml2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ilaenv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgelsy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaic1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlapy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarz.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasq6.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormlq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iparmq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqp3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaisnan.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqp2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarzt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdq.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lsame.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlals0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqps.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlas2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasdt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasrt.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/xerbla.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgeev.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrevc3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebal.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dhseqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorghr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgebak.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dgehd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlahr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaln2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorgqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorg2r.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlanv2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dladiv.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr5.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dtrexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormhr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaqr1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaexc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlarfx.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlasy2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsyevd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlansy.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsterf.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dstedc.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormtr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlae2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlatrd.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsytd2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dormql.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dsteqr.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed0.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaev2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dorm2l.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed1.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed7.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed8.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed9.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed3.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaeda.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed2.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed4.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dlaed5.o :  
@@ -0,0 +1,138 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DGMSolver.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HiReconstruction.o : 
@@ -0,0 +1,345 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2Mesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshInPlane.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Intx2MeshOnSphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxRllCssphere.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IntxUtils.o : 
@@ -0,0 +1,414 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ElemEvaluator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearHex.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearQuad.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LinearTri.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/QuadraticHex.o : 
@@ -0,0 +1,5106 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AdaptiveKDTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AEntityFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AffineXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/AxisBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitPage.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BitTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BoundBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BSPTreePoly.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/BVHTree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CartVect.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/CN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Core.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DebugOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DualTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/EntitySequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorHandler.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ErrorOutput.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Factory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FBEngine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomQueryTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomTopoTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GeomUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HalfFacetRep.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HigherOrderFactory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/HomXform.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/iMOAB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/LloydSmoother.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshGeneration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshSetSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/MeshTopoUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NestedRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/OrientedBoxTreeTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/PolyElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProgOptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Range.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/RangeSeqIntersectIter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReaderWriterSet.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReorderTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdInterface.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ScdVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SetIterator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Skinner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothCurve.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SmoothFace.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpatialLocator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SpectralMeshTool.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/StructuredElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptElementSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SweptVertexData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SysUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TagInfo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tree.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TupleList.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Types.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/TypeSequenceManager.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/UnstructuredElemSeq.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenDenseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VarLenSparseTag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VertexSequence.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteUtil.o : 
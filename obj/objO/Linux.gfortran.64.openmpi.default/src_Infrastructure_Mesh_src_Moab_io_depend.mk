@@ -0,0 +1,1863 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ExoIIUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/FileTokenizer.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/GmshUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/IODebugTrack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadABAQUS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadIDEAS.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadMCNP5.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadNASTRAN.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadOBJ.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadRTT.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSms.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadTetGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadVtk.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SMF_State.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/Tqdcfr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VtkUtil.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteAns.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGmsh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteGMV.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSmf.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteSTL.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteTemplate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/WriteVtk.o : 
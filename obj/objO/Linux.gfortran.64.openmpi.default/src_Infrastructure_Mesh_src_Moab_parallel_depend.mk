@@ -0,0 +1,552 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/gs.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelComm.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelData.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParallelMergeMesh.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ParCommGraph.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ProcConfig.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ReadParallel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/SharedSetData.o : 
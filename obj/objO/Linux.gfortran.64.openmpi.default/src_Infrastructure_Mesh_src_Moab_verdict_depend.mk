@@ -0,0 +1,759 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_EdgeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictVector.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/VerdictWrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_GaussIntegration.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_HexMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_KnifeMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_PyramidMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_QuadMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TetMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_TriMetric.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/V_WedgeMetric.o : 
@@ -0,0 +1,1241 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Conserve2ndInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ConserveInterp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ExtrapolationPoleLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IncrRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Integrate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Interp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mapping.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CreepFill.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRegrid.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PatchRecovery.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Helper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestDToSLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SearchNearestNPntsLGC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeFunc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SpaceDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WMat.o : 
@@ -0,0 +1,414 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm.o : ESMCI_Alarm.h ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock.o : ESMCI_Alarm.h ESMCI_Clock.h
@@ -0,0 +1,408 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/esmftrc.o : esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace.o : ESMCI_ComponentInfo.h ESMCI_HashMap.h ESMCI_RegionNode.h ESMCI_RegionSummary.h ESMCI_Trace.h ESMCI_TraceSample.h ESMCI_TraceUtil.h esmftrc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceWrap.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceMetadata.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceClock.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TraceSample.o : ESMCI_HashMap.h ESMCI_Trace.h ESMCI_TraceSample.h
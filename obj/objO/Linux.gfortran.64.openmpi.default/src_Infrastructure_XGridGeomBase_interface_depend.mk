@@ -0,0 +1,69 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridGeomBase_F.o : 
@@ -0,0 +1,276 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGrid.o : ESMCI_XGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_XGrid.o : ESMCI_XGrid.h ESMC_XGrid.h
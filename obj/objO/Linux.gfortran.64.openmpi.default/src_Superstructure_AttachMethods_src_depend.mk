@@ -0,0 +1,69 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
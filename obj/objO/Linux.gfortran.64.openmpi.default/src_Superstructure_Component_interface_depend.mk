@@ -0,0 +1,207 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Comp.o : ESMCI_Comp.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Comp.o : ESMCI_Comp.h ESMCI_FTable.h ESMC_CplComp.h ESMC_GridComp.h ESMC_SciComp.h
@@ -0,0 +1,483 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FTable.o : ESMCI_Comp.h ESMCI_CompTunnel.h ESMCI_FTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MethodTable.o : ESMCI_MethodTable.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CompTunnel.o : ESMCI_CompTunnel.h
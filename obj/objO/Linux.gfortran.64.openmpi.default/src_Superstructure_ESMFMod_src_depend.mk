@@ -0,0 +1,138 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Array.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttachMethods.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Attribute.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Config.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Container.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DELayout.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DistGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_DynamicMask.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldBundle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldEmpty.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGather.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldGetAllocBounds.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldHalo.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldPr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRedist.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldRegrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSMM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldScatter.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldSet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FieldWr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Grid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IO_YAML.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Info.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocStream.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LocalArray.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogPublic.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Mesh.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Regrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SciComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLoc.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateReconcile2.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateVa.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TraceAPI.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGrid.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGeomBase.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_XGridGet.o 
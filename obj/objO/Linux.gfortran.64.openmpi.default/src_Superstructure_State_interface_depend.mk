@@ -0,0 +1,276 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArrayCreate.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Field.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State.o : ESMCI_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_State.o : ESMCI_State.h ESMC_State.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_State_F.o : ESMCI_State.h
@@ -0,0 +1,1173 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryDef.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOScrip.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FieldDictionaryApi.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Compliance_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Auxiliary.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_FreeFormatDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Model.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Mediator.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_ModelBase.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Driver.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_RunSequenceDef.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC_Connector.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/NUOPC.o 
@@ -0,0 +1,276 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Test.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ComplianceIC.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Test.o : ESMCI_Test.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Test.o : ESMCI_Test.h ESMC_Test.h
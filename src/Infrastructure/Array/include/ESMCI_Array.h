@@ -33,6 +33,7 @@
 
 namespace ESMCI {
   class Array;
+  struct IO_ArrayPlan;
 }
 
 #include "ESMCI_Base.h"       // Base is superclass to Array
@@ -239,6 +240,7 @@ namespace ESMCI {
                           // TODO: and DELayout cannot be pulled from under
                           // TODO: DistGrid and Array until they are destroyed.
     RouteHandle *ioRH;    // RouteHandle to store redist if needed during IO
+    IO_ArrayPlan *ioPlan; // temporary Arrays kept between IO writes
 
    public:
     // native constructor and destructor
@@ -278,6 +280,7 @@ namespace ESMCI {
       rimElementCount.resize(0);
       localDeCountAux = 0;  // auxiliary variable for garbage collection
       ioRH = NULL;
+      ioPlan = NULL;
     }
     Array(int baseID):ESMC_Base(baseID){  // prevent baseID counter increment
       typekind = ESMF_NOKIND;
@@ -315,6 +318,7 @@ namespace ESMCI {
       rimElementCount.resize(0);
       localDeCountAux = 0;  // auxiliary variable for garbage collection
       ioRH = NULL;
+      ioPlan = NULL;
     }
    private:
     Array(ESMC_TypeKind_Flag typekind, int rank, LocalArray **larrayList,
@@ -393,6 +397,8 @@ namespace ESMCI {
     DELayout *getDELayout()                 const {return delayout;}
     RouteHandle *getIoRH()                  const {return ioRH;}
     void setIoRH(RouteHandle *rh){ioRH = rh;}
+    IO_ArrayPlan *getIoPlan()               const {return ioPlan;}
+    void setIoPlan(IO_ArrayPlan *plan){ioPlan = plan;}
     int getLinearIndexExclusive(int localDe, int const *index)const;
     template<typename T> int getSequenceIndexExclusive(int localDe,
       int const *index, SeqIndex<T> *seqIndex, bool recursive=true,
@@ -418,6 +424,8 @@ namespace ESMCI {
     int setName(const std::string &name){return ESMC_BaseSetName(name.c_str(), "Array");}
     // misc.
     bool isRHCompatible(Array const *array, int *rc=NULL)const;
+    ESMC_I8 getRHCompatibleHash()const;
+    int fingerprint(std::vector<ESMC_I8> &content)const;
     static ArrayMatch_Flag match(Array const *array1, Array const *array2,
       int *rc=NULL);
     static bool matchBool(Array const *array1, Array const *array2, int *rc=NULL);
@@ -458,7 +466,13 @@ namespace ESMCI {
       int *pipelineDepthArg=NULL);
     static int halo(Array *array,
       RouteHandle **routehandle, ESMC_CommFlag commflag=ESMF_COMM_BLOCKING,
-      bool *finishedflag=NULL, bool *cancelledflag=NULL, bool checkflag=false);
+      bool *finishedflag=NULL, bool *cancelledflag=NULL, bool checkflag=false,
+      XXE::WaitOnAnyCallback waitOnAnyCallback=NULL,
+      void *waitOnAnyUserData=NULL);
+    int getHaloInteriorBounds(
+      ESMC_HaloStartRegionFlag halostartregionflag=ESMF_REGION_EXCLUSIVE,
+      InterArray<int> *haloLDepth=NULL, InterArray<int> *haloUDepth=NULL,
+      int *interiorLBound=NULL, int *interiorUBound=NULL)const;
     static int haloRelease(RouteHandle *routehandle);
     static int redistStore(Array *srcArray, Array *dstArray,
       RouteHandle **routehandle, InterArray<int> *srcToDstTransposeMap=NULL,
@@ -491,7 +505,9 @@ namespace ESMCI {
       bool *finishedflag=NULL, bool *cancelledflag=NULL,
       ESMC_Region_Flag zeroflag=ESMC_REGION_TOTAL,
       ESMC_TermOrder_Flag termorderflag=ESMC_TERMORDER_FREE,
-      bool checkflag=false, bool haloFlag=false);
+      bool checkflag=false, bool haloFlag=false,
+      XXE::WaitOnAnyCallback waitOnAnyCallback=NULL,
+      void *waitOnAnyUserData=NULL);
     static int sparseMatMulRelease(RouteHandle *routehandle);
     static void superVecParam(Array *array, int localDeCount,
       bool superVectorOkay, int superVecSizeUnd[3], int *superVecSizeDis[2],
@@ -635,6 +651,41 @@ namespace ESMCI {
   };  // class ArrayElement
   //============================================================================
 
+
+  //============================================================================
+  class ArrayElementRun : public MultiDimIndexLoop{
+    // Iterator type through runs of Array elements along the first Array
+    // dimension of the exclusive region. The elements of a run have
+    // consecutive linear indices, and their sequence indices are filled in
+    // bulk for the entire run.
+    Array const *array;               // associated Array object
+    int localDe;                      // localDe index
+    //
+    int linIndex;                     // linear index of first element in run
+    int count;                        // number of elements in run
+    bool decompRunFlag;               // decompSeqIndex increments along run
+    bool tensorRunFlag;               // tensorSeqIndex increments along run
+   public:
+    ArrayElementRun(Array const *arrayArg, int localDeArg);
+      // construct iterator through exclusive Array region
+    int getLinearIndex()const{
+      // return the linear index of the first element of the run
+      return linIndex;
+    }
+    int getCount()const{
+      // return the number of elements in the run
+      return count;
+    }
+    template<typename T> void fillSequenceIndex(
+      std::vector<SeqIndex<T> > &seqIndexList)const;
+    void next(){
+      MultiDimIndexLoop::next();
+      if (!isWithin()) return;  // reached the end of iteration
+      linIndex = array->getLinearIndexExclusive(localDe, &indexTuple[0]);
+    }
+  };  // class ArrayElementRun
+  //============================================================================
+
 } // namespace ESMCI
 
 
@@ -357,25 +357,28 @@ template<typename IT1, typename IT2>
       }
     }else{
       // loop over all elements in the exclusive region for localDe j
-      ArrayElement arrayElement(fillLinSeqVectInfo->array, j, true, false,
-        false);
-      while(arrayElement.isWithin()){
-        SeqIndex<IT1> seqIndex = arrayElement.getSequenceIndex<IT1>();
-        IT1 seqInd = seqIndex.decompSeqIndex;
-        if (seqInd >= seqIndMin && seqInd <= seqIndMax){
-          int lookupIndex = (int)(seqInd - seqIndMin);
-          if (tensorMixFlag)
-            lookupIndex += (seqIndex.tensorSeqIndex - 1) * (int)seqIndCount;
-          *requestStreamClientInt++   = lookupIndex;
-          *requestStreamClientInt++   = j;
-          IT1 *requestStreamClientIT1 = (IT1 *)requestStreamClientInt;
-          *requestStreamClientIT1++   = seqIndex.decompSeqIndex;
-          requestStreamClientInt      = (int *)requestStreamClientIT1;
-          *requestStreamClientInt++   = seqIndex.tensorSeqIndex;
-          *requestStreamClientInt++   =
-            arrayElement.getLinearIndex();
+      ArrayElementRun arrayElementRun(fillLinSeqVectInfo->array, j);
+      vector<SeqIndex<IT1> > seqIndexRun;
+      while(arrayElementRun.isWithin()){
+        arrayElementRun.fillSequenceIndex(seqIndexRun);
+        for (int k=0; k<arrayElementRun.getCount(); k++){
+          SeqIndex<IT1> seqIndex = seqIndexRun[k];
+          IT1 seqInd = seqIndex.decompSeqIndex;
+          if (seqInd >= seqIndMin && seqInd <= seqIndMax){
+            int lookupIndex = (int)(seqInd - seqIndMin);
+            if (tensorMixFlag)
+              lookupIndex += (seqIndex.tensorSeqIndex - 1) * (int)seqIndCount;
+            *requestStreamClientInt++   = lookupIndex;
+            *requestStreamClientInt++   = j;
+            IT1 *requestStreamClientIT1 = (IT1 *)requestStreamClientInt;
+            *requestStreamClientIT1++   = seqIndex.decompSeqIndex;
+            requestStreamClientInt      = (int *)requestStreamClientIT1;
+            *requestStreamClientInt++   = seqIndex.tensorSeqIndex;
+            *requestStreamClientInt++   =
+              arrayElementRun.getLinearIndex() + k;
+          }
         }
-        arrayElement.next();
+        arrayElementRun.next();
       } // end while over all exclusive elements
     }
   }
@@ -425,25 +428,28 @@ template<typename IT1, typename IT2>
       }
     }else{
       // loop over all elements in the exclusive region for localDe j
-      ArrayElement arrayElement(fillLinSeqVectInfo->array, j, true, false,
-        false);
-      while(arrayElement.isWithin()){
-        SeqIndex<IT1> seqIndex = arrayElement.getSequenceIndex<IT1>();
-        IT1 seqInd = seqIndex.decompSeqIndex;
-        if (seqInd >= seqIndMin && seqInd <= seqIndMax){
-          int lookupIndex = (int)(seqInd - seqIndMin);
-          if (tensorMixFlag)
-            lookupIndex += (seqIndex.tensorSeqIndex - 1) * (int)seqIndCount;
-          int factorCount = seqIndexFactorLookup[lookupIndex].factorCount;
-          if (factorCount > 0){
-            AssociationElement<SeqIndex<IT1>,SeqIndex<IT2> > element;
-            element.factorList = seqIndexFactorLookup[lookupIndex].factorList;
-            element.linIndex = arrayElement.getLinearIndex();
-            element.seqIndex = seqIndex;
-            linSeqVect[j].push_back(element);
-         }
+      ArrayElementRun arrayElementRun(fillLinSeqVectInfo->array, j);
+      vector<SeqIndex<IT1> > seqIndexRun;
+      while(arrayElementRun.isWithin()){
+        arrayElementRun.fillSequenceIndex(seqIndexRun);
+        for (int k=0; k<arrayElementRun.getCount(); k++){
+          SeqIndex<IT1> seqIndex = seqIndexRun[k];
+          IT1 seqInd = seqIndex.decompSeqIndex;
+          if (seqInd >= seqIndMin && seqInd <= seqIndMax){
+            int lookupIndex = (int)(seqInd - seqIndMin);
+            if (tensorMixFlag)
+              lookupIndex += (seqIndex.tensorSeqIndex - 1) * (int)seqIndCount;
+            int factorCount = seqIndexFactorLookup[lookupIndex].factorCount;
+            if (factorCount > 0){
+              AssociationElement<SeqIndex<IT1>,SeqIndex<IT2> > element;
+              element.factorList = seqIndexFactorLookup[lookupIndex].factorList;
+              element.linIndex = arrayElementRun.getLinearIndex() + k;
+              element.seqIndex = seqIndex;
+              linSeqVect[j].push_back(element);
+           }
+          }
         }
-        arrayElement.next();
+        arrayElementRun.next();
       } // end while over all exclusive elements
     }
   }
@@ -799,19 +805,24 @@ template<typename IT1, typename IT2>
           }
         }else{
           // loop over all elements in the exclusive region for localDe j
-          ArrayElement arrayElement(array, j, true, false, false);
-          while(arrayElement.isWithin()){
-            SeqIndex<IT> seqIndex = arrayElement.getSequenceIndex<IT>();
-            IT seqInd = seqIndex.decompSeqIndex;
-            if (seqInd >= seqIndMin && seqInd <= seqIndMax){
-              int lookupIndex = (int)(seqInd - seqIndMin);
-              if (tensorMixFlag)
-                lookupIndex += (seqIndex.tensorSeqIndex - 1) * (int)seqIndCount;
-              bufferInt[2*jj] = lookupIndex;
-              bufferInt[2*jj+1] = de;
-              ++jj; // increment counter
+          ArrayElementRun arrayElementRun(array, j);
+          vector<SeqIndex<IT> > seqIndexRun;
+          while(arrayElementRun.isWithin()){
+            arrayElementRun.fillSequenceIndex(seqIndexRun);
+            for (int k=0; k<arrayElementRun.getCount(); k++){
+              SeqIndex<IT> seqIndex = seqIndexRun[k];
+              IT seqInd = seqIndex.decompSeqIndex;
+              if (seqInd >= seqIndMin && seqInd <= seqIndMax){
+                int lookupIndex = (int)(seqInd - seqIndMin);
+                if (tensorMixFlag)
+                  lookupIndex += (seqIndex.tensorSeqIndex - 1)
+                    * (int)seqIndCount;
+                bufferInt[2*jj] = lookupIndex;
+                bufferInt[2*jj+1] = de;
+                ++jj; // increment counter
+              }
             }
-            arrayElement.next();
+            arrayElementRun.next();
           } // end while over all exclusive elements
         }
       }
@@ -861,23 +872,28 @@ template<typename IT1, typename IT2>
           }
         }else{
           // loop over all elements in the exclusive region for localDe j
-          ArrayElement arrayElement(array, j, true, false, false);
-          while(arrayElement.isWithin()){
-            SeqIndex<IT> seqIndex = arrayElement.getSequenceIndex<IT>();
-            IT seqInd = seqIndex.decompSeqIndex;
-            if (seqInd >= seqIndMin && seqInd <= seqIndMax){
-              int lookupIndex = (int)(seqInd - seqIndMin);
-              if (tensorMixFlag)
-                lookupIndex += (seqIndex.tensorSeqIndex - 1) * (int)seqIndCount;
-              if (seqIndexFactorLookup[lookupIndex].factorCount > 0){
-                // element with factors -> fill in the DE
-                seqIndexFactorLookup[lookupIndex].de.push_back(de);
-                // this will lead to duplicate de entries for cases with tensor
-                // elements but no tensor mixing
-                // -> duplicates must be eliminated by the calling code
+          ArrayElementRun arrayElementRun(array, j);
+          vector<SeqIndex<IT> > seqIndexRun;
+          while(arrayElementRun.isWithin()){
+            arrayElementRun.fillSequenceIndex(seqIndexRun);
+            for (int k=0; k<arrayElementRun.getCount(); k++){
+              SeqIndex<IT> seqIndex = seqIndexRun[k];
+              IT seqInd = seqIndex.decompSeqIndex;
+              if (seqInd >= seqIndMin && seqInd <= seqIndMax){
+                int lookupIndex = (int)(seqInd - seqIndMin);
+                if (tensorMixFlag)
+                  lookupIndex += (seqIndex.tensorSeqIndex - 1)
+                    * (int)seqIndCount;
+                if (seqIndexFactorLookup[lookupIndex].factorCount > 0){
+                  // element with factors -> fill in the DE
+                  seqIndexFactorLookup[lookupIndex].de.push_back(de);
+                  // this will lead to duplicate de entries for cases with
+                  // tensor elements but no tensor mixing
+                  // -> duplicates must be eliminated by the calling code
+                }
               }
             }
-            arrayElement.next();
+            arrayElementRun.next();
           } // end while over all exclusive elements
         }
       }
@@ -1588,23 +1604,27 @@ template<typename SIT, typename DIT> int sparseMatMulStoreLinSeqVect(
   for (int i=0; i<srcLocalDeCount; i++){
     if (srcLocalDeElementCount[i]){
       // there are elements for local DE i
-      ArrayElement arrayElement(srcArray, i, true, false, false);
+      ArrayElementRun arrayElementRun(srcArray, i);
+      vector<SeqIndex<SIT> > seqIndexRun;
       // loop over all elements in exclusive region for local DE i
-      while(arrayElement.isWithin()){
-        // determine the sequentialized index for the current Array element
-        SeqIndex<SIT> seqIndex = arrayElement.getSequenceIndex<SIT>();
-        // record seqIndex min and max
-        if (firstMinMax){
-          srcSeqIndexMinMax[0] = srcSeqIndexMinMax[1]
-            = seqIndex.decompSeqIndex; // initialize
-          firstMinMax = false;
-        }else{
-          if (seqIndex.decompSeqIndex < srcSeqIndexMinMax[0])
-            srcSeqIndexMinMax[0] = seqIndex.decompSeqIndex;
-          if (seqIndex.decompSeqIndex > srcSeqIndexMinMax[1])
-            srcSeqIndexMinMax[1] = seqIndex.decompSeqIndex;
+      while(arrayElementRun.isWithin()){
+        arrayElementRun.fillSequenceIndex(seqIndexRun);
+        for (int k=0; k<arrayElementRun.getCount(); k++){
+          // determine the sequentialized index for the current Array element
+          SeqIndex<SIT> seqIndex = seqIndexRun[k];
+          // record seqIndex min and max
+          if (firstMinMax){
+            srcSeqIndexMinMax[0] = srcSeqIndexMinMax[1]
+              = seqIndex.decompSeqIndex; // initialize
+            firstMinMax = false;
+          }else{
+            if (seqIndex.decompSeqIndex < srcSeqIndexMinMax[0])
+              srcSeqIndexMinMax[0] = seqIndex.decompSeqIndex;
+            if (seqIndex.decompSeqIndex > srcSeqIndexMinMax[1])
+              srcSeqIndexMinMax[1] = seqIndex.decompSeqIndex;
+          }
         }
-        arrayElement.next();
+        arrayElementRun.next();
       } // end while over all exclusive elements
     }
   }
@@ -1667,23 +1687,27 @@ template<typename SIT, typename DIT> int sparseMatMulStoreLinSeqVect(
           }
         }
       }else{
-        ArrayElement arrayElement(dstArray, i, true, false, false);
+        ArrayElementRun arrayElementRun(dstArray, i);
+        vector<SeqIndex<DIT> > seqIndexRun;
         // loop over all elements in exclusive region for local DE i
-        while(arrayElement.isWithin()){
-          // determine the sequentialized index for the current Array element
-          SeqIndex<DIT> seqIndex = arrayElement.getSequenceIndex<DIT>();
-          // record seqIndex min and max
-          if (firstMinMax){
-            dstSeqIndexMinMax[0] = dstSeqIndexMinMax[1]
-              = seqIndex.decompSeqIndex; // initialize
-            firstMinMax = false;
-          }else{
-            if (seqIndex.decompSeqIndex < dstSeqIndexMinMax[0])
-              dstSeqIndexMinMax[0] = seqIndex.decompSeqIndex;
-            if (seqIndex.decompSeqIndex > dstSeqIndexMinMax[1])
-              dstSeqIndexMinMax[1] = seqIndex.decompSeqIndex;
+        while(arrayElementRun.isWithin()){
+          arrayElementRun.fillSequenceIndex(seqIndexRun);
+          for (int k=0; k<arrayElementRun.getCount(); k++){
+            // determine the sequentialized index for the current Array element
+            SeqIndex<DIT> seqIndex = seqIndexRun[k];
+            // record seqIndex min and max
+            if (firstMinMax){
+              dstSeqIndexMinMax[0] = dstSeqIndexMinMax[1]
+                = seqIndex.decompSeqIndex; // initialize
+              firstMinMax = false;
+            }else{
+              if (seqIndex.decompSeqIndex < dstSeqIndexMinMax[0])
+                dstSeqIndexMinMax[0] = seqIndex.decompSeqIndex;
+              if (seqIndex.decompSeqIndex > dstSeqIndexMinMax[1])
+                dstSeqIndexMinMax[1] = seqIndex.decompSeqIndex;
+            }
           }
-          arrayElement.next();
+          arrayElementRun.next();
         } // end while over all exclusive elements
       }
     }
@@ -1804,12 +1828,16 @@ template<typename SIT, typename DIT> int sparseMatMulStoreLinSeqVect(
     int jj=0;
     for (int j=0; j<srcLocalDeCount; j++){
       // loop over all elements in the exclusive region for localDe j
-      ArrayElement arrayElement(srcArray, j, true, false, false);
-      while(arrayElement.isWithin()){
-        SeqIndex<SIT> seqIndex = arrayElement.getSequenceIndex<SIT>();
-        seqIndexList[jj] = seqIndex.decompSeqIndex;
-        ++jj;
-        arrayElement.next();
+      ArrayElementRun arrayElementRun(srcArray, j);
+      vector<SeqIndex<SIT> > seqIndexRun;
+      while(arrayElementRun.isWithin()){
+        arrayElementRun.fillSequenceIndex(seqIndexRun);
+        for (int k=0; k<arrayElementRun.getCount(); k++){
+          SeqIndex<SIT> seqIndex = seqIndexRun[k];
+          seqIndexList[jj] = seqIndex.decompSeqIndex;
+          ++jj;
+        }
+        arrayElementRun.next();
       } // end while over all exclusive elements
     }
     sort(seqIndexList.begin(), seqIndexList.end());
@@ -1940,12 +1968,16 @@ template<typename SIT, typename DIT> int sparseMatMulStoreLinSeqVect(
         }
       }else{
         // loop over all elements in the exclusive region for localDe j
-        ArrayElement arrayElement(dstArray, j, true, false, false);
-        while(arrayElement.isWithin()){
-          SeqIndex<DIT> seqIndex = arrayElement.getSequenceIndex<DIT>();
-          seqIndexList[jj] = seqIndex.decompSeqIndex;
-          ++jj;
-          arrayElement.next();
+        ArrayElementRun arrayElementRun(dstArray, j);
+        vector<SeqIndex<DIT> > seqIndexRun;
+        while(arrayElementRun.isWithin()){
+          arrayElementRun.fillSequenceIndex(seqIndexRun);
+          for (int k=0; k<arrayElementRun.getCount(); k++){
+            SeqIndex<DIT> seqIndex = seqIndexRun[k];
+            seqIndexList[jj] = seqIndex.decompSeqIndex;
+            ++jj;
+          }
+          arrayElementRun.next();
         } // end while over all exclusive elements
       }
     }
@@ -21,6 +21,7 @@
 #include <cstring>
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
@@ -89,13 +90,14 @@ class Attribute
     std::vector<Attribute*>  packList;  // attributes - array of pointers
     std::vector<Attribute*>  linkList;  // attributes - array of pointers
 
-    // Attribute values
-    std::vector<ESMC_I4>       vip;       // vector of integers
-    std::vector<ESMC_I8>       vlp;       // vector of longs
-    std::vector<ESMC_R4>       vfp;       // vector of floats (real*4)
-    std::vector<ESMC_R8>       vdp;       // vector of doubles (real*8)
-    std::vector<ESMC_Logical>  vbp;       // vector of booleans (logical)
-    std::vector<std::string>   vcpp;      // vector of strings
+    // name index into attrList, first Attribute of each name
+    std::unordered_map<std::string, Attribute*> attrIndex;
+
+    // Attribute values: a single vector of the typekind valueKind, i.e.
+    // std::vector of ESMC_I4, ESMC_I8, ESMC_R4, ESMC_R8, ESMC_Logical or
+    // std::string, or NULL if there are no values
+    void *values;
+    ESMC_TypeKind_Flag valueKind;
 
     std::string attrGUID;                 // Globally Unique Identifier for
                                           //  an Attribute or Attpack
@@ -117,6 +119,30 @@ class Attribute
     // prevent accidental copying
     Attribute(const Attribute&);
 
+    // access to the values
+    template<typename T>
+      const std::vector<T> &valuesGet(ESMC_TypeKind_Flag kind) const;
+    template<typename T>
+      std::vector<T> &valuesReset(ESMC_TypeKind_Flag kind);
+    void valuesRelease();
+    const std::vector<ESMC_I4> &vip() const
+      {return valuesGet<ESMC_I4>(ESMC_TYPEKIND_I4);}
+    const std::vector<ESMC_I8> &vlp() const
+      {return valuesGet<ESMC_I8>(ESMC_TYPEKIND_I8);}
+    const std::vector<ESMC_R4> &vfp() const
+      {return valuesGet<ESMC_R4>(ESMC_TYPEKIND_R4);}
+    const std::vector<ESMC_R8> &vdp() const
+      {return valuesGet<ESMC_R8>(ESMC_TYPEKIND_R8);}
+    const std::vector<ESMC_Logical> &vbp() const
+      {return valuesGet<ESMC_Logical>(ESMC_TYPEKIND_LOGICAL);}
+    const std::vector<std::string> &vcpp() const
+      {return valuesGet<std::string>(ESMC_TYPEKIND_CHARACTER);}
+
+    // maintenance of the name index
+    Attribute *attrListFind(const std::string &name) const;
+    void attrIndexAdd(Attribute *attr);
+    void attrIndexBuild();
+
 //-----------------------------------------------------------------------------
  public:
     // constant strings for conventions and purposes
@@ -413,6 +439,25 @@ class Attribute
     const std::string getTime() const;
     std::string month2Num(std::string month) const;
 };
+
+  // values of the given typekind, empty if the Attribute holds none
+  template<typename T>
+    const std::vector<T> &Attribute::valuesGet(ESMC_TypeKind_Flag kind) const {
+    static const std::vector<T> none;
+    if (values == NULL || valueKind != kind) return none;
+    return *static_cast<const std::vector<T> *>(values);
+  }
+
+  // replace the values by an empty vector of the given typekind
+  template<typename T>
+    std::vector<T> &Attribute::valuesReset(ESMC_TypeKind_Flag kind) {
+    valuesRelease();
+    std::vector<T> *v = new std::vector<T>;
+    values = v;
+    valueKind = kind;
+    return *v;
+  }
+
 } // namespace
 
 // fortran interface functions to attribute objects
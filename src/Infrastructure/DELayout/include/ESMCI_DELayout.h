@@ -309,6 +309,11 @@ class XXE{
     static int const filterBitNbWaitFinish      = 0x10; // non-block wait&finish
     static int const filterBitCancel            = 0x20; // cancel
     static int const filterBitNbWaitFinishSingleSum = 0x40; // single sum
+    static int const filterBitNbWaitFinishAny   = 0x80; // non-block wait any
+    
+    // callback invoked by waitOnAnyIndexSub each time a sub has been executed
+    // for a completed communication, with the PET of the communication partner
+    typedef void (*WaitOnAnyCallback)(int pet, void *userData);
 
     struct BufferInfo{
       // The BufferInfo provides an extra level of indirection to XXE managed
@@ -367,6 +372,9 @@ class XXE{
     // MISC
     int lastFilterBitField;         // filterBitField during last exec() call
     bool superVectorOkay;           // flag to indicate that super-vector okay
+    WaitOnAnyCallback waitOnAnyCallback;  // optional callback for
+                                          // waitOnAnyIndexSub during exec()
+    void *waitOnAnyUserData;        // user data passed to waitOnAnyCallback
   private:
     int max;                        // maximum number of elements in stream
     int dataMaxCount;               // maximum number of elements in data
@@ -393,6 +401,8 @@ class XXE{
       bufferInfoList.reserve(10000);  // initial preparation
       lastFilterBitField = 0x0;
       superVectorOkay = true;
+      waitOnAnyCallback = NULL;
+      waitOnAnyUserData = NULL;
       rh = NULL;
     }
     XXE(std::stringstream &streami,
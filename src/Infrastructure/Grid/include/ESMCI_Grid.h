@@ -39,6 +39,8 @@
 #include "ESMCI_Util.h"
 #include "ESMCI_CoordSys.h"
 
+#include <vector>
+
 // Define prototype coordGeom flag
 #define ESMC_GRIDCOORDGEOM_CART 0
 #define ESMC_GRIDCOORDGEOM_SPH_DEG 1
@@ -65,6 +67,23 @@ namespace ESMCI {
 
 class Grid;
 class ProtoGrid;
+class Mesh;
+
+// Mesh converted from a Grid staggerloc for regridding. It is shared by the
+// Grid mesh cache and every MeshCap handed out for it, the last reference
+// released deletes the Mesh.
+struct GridMeshRef {
+  Mesh *mesh;
+  int refCount;
+};
+
+// Cache entry for a converted Mesh, kept for reuse
+struct GridMeshCacheEntry {
+  int staggerloc;
+  ESMC_I8 optionKey;   // hash of the conversion options (mask values, etc.)
+  ESMC_I8 contentKey;  // Grid::getContentHash() at time of conversion
+  GridMeshRef *ref;    // holds one reference for the cache
+};
 
 // class definition
 class Grid : public ESMC_Base {    // inherits from ESMC_Base class
@@ -173,6 +192,9 @@ class Grid : public ESMC_Base {    // inherits from ESMC_Base class
 
   DistGrid **staggerDistgridList; // [staggerloc]
 
+  // Meshes converted from this Grid, owned by the Grid (see getCachedMesh())
+  mutable std::vector<GridMeshCacheEntry> meshCache;
+
   // Private methods:
 
   // Set internal array
@@ -382,6 +404,17 @@ template <class TYPE>
   // detect if a given staggerloc has a item
   bool hasItemStaggerLoc(int staggerloc, int item);
 
+  // hash of the local coordinate and item data of all staggerlocs
+  ESMC_I8 getContentHash() const;
+
+  // Mesh cache used by the Grid to Mesh conversion
+  GridMeshRef *getCachedMesh(int staggerloc, ESMC_I8 optionKey,
+    ESMC_I8 contentKey) const;
+  GridMeshRef *addCachedMesh(int staggerloc, ESMC_I8 optionKey,
+    ESMC_I8 contentKey, Mesh *mesh) const;
+  void clearMeshCache(ESMC_I8 contentKey=0) const;
+  static void releaseCachedMesh(GridMeshRef *ref);
+
   // Set data in an empty grid before commit
   int set(
       int _nameLen,                                // (in)
@@ -78,6 +78,7 @@
 #define pio_cpp_getnum_ost	esmcpio_cpp_getnum_ost
 #define pio_cpp_setnum_ost	esmcpio_cpp_setnum_ost
 #define pio_cpp_file_is_open	esmcpio_cpp_file_is_open
+#define pio_cpp_file_ncid	esmcpio_cpp_file_ncid
 #define pio_cpp_inquire	esmcpio_cpp_inquire
 #define pio_cpp_inq_att_vid	esmcpio_cpp_inq_att_vid
 #define pio_cpp_inq_att_vdesc	esmcpio_cpp_inq_att_vdesc
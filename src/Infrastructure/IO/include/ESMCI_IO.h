@@ -115,6 +115,17 @@ namespace ESMCI {
 
   class IO;
 
+  // Objects made for writing an Array, kept with the Array (see
+  // Array::getIoPlan()) so that repeated writes only move data.
+  struct IO_ArrayPlan {
+    DistGrid *distgrid;           // DistGrid of the Array the plan is for
+    int distgridID;               // Base ID of that DistGrid
+    bool need_redist;             // result of redist_check()
+    Array *redistArray;           // 1 DE per PET Array, or NULL
+    Array *alldistArray;          // alias with all dimensions distributed,
+                                  // or NULL
+  };
+
   // class definitions
   
   //===========================================================================
@@ -128,11 +139,14 @@ namespace ESMCI {
   // global information
     IO_Handler    *ioHandler;
     std::vector<IO_ObjectContainer *> objects;
+    IO_StorageOptions storageOptions; // for variables created by writes
+    bool storageOptionsSet;           // false: ESMF_RUNTIME_IO_* defaults
     
   public:
     // native constructor and destructor
     IO(int *rc = NULL) {
       ioHandler = (IO_Handler *)NULL;
+      storageOptionsSet = false;
       // No constructor call for objects -- use default Allocator
       // return successfully
       if (rc != NULL) {
@@ -171,6 +185,11 @@ namespace ESMCI {
 
     // get() and set()
     const char *getName() const { return "ESMCI::IO"; }
+    // Replace the ESMF_RUNTIME_IO_* storage options for files opened later
+    void setStorageOptions(const IO_StorageOptions &options) {
+      storageOptions = options;
+      storageOptionsSet = true;
+    }
 
     // match()
     static bool match(IO const * const io1, IO const * const io2,
@@ -219,6 +238,7 @@ namespace ESMCI {
     void redist_arraycreate1de(Array *src_array_p, Array **dst_array_p, int petCount, int *rc);
     bool undist_check(Array *array_p, int *rc);
     void undist_arraycreate_alldist(Array *src_array_p, Array **dst_array_p, int *rc);
+    static int destroyPlan(IO_ArrayPlan **plan);
     void clear();
 
 // TBI
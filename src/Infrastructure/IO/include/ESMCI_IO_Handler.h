@@ -53,6 +53,38 @@ namespace ESMCI {
 
   class IO_Handler;
 
+  // Lossless compression filter for variables in NetCDF-4 files
+  enum IO_Compressor {IO_COMPRESS_NONE=0, IO_COMPRESS_DEFLATE,
+                      IO_COMPRESS_ZSTD};
+  // How the chunk shape of a variable in a NetCDF-4 file is chosen
+  enum IO_Chunking {IO_CHUNK_DECOMP=0,    // largest DE block of the Array
+                    IO_CHUNK_SHAPE,       // IO_StorageOptions::chunkShape
+                    IO_CHUNK_CONTIGUOUS,  // no chunks, if possible
+                    IO_CHUNK_LIBRARY};    // the NetCDF library default
+
+  // Storage options for variables created by a write. Compression and
+  // chunking only apply to NetCDF-4 files, quantization to R4 and R8 data
+  // in any NetCDF file.
+  struct IO_StorageOptions {
+    IO_Compressor compressor;     // lossless compression filter
+    int level;                    // compression level, < 0 for default
+    bool shuffle;                 // byte shuffle before compression
+    IO_Chunking chunking;         // chunk shape policy
+    std::vector<int> chunkShape;  // chunk extent per Array IO dimension
+    int quantizeBits;             // mantissa bits kept, 0 for all
+    IO_StorageOptions() : compressor(IO_COMPRESS_NONE), level(-1),
+      shuffle(true), chunking(IO_CHUNK_DECOMP), quantizeBits(0) {}
+  };
+
+  // An Array and its write options, queued for IO_Handler::arrayWriteMulti()
+  struct IO_ArrayWriteItem {
+    Array *array;                         // Array to write
+    const char *name;                     // Optional variable name
+    std::vector<std::string> dimLabels;   // Optional dimension labels
+    const Attribute *varAttPack;          // Optional per-variable Att Package
+    const Attribute *gblAttPack;          // Optional global Att Package
+  };
+
   // class definitions
   
   //===========================================================================
@@ -70,6 +102,7 @@ namespace ESMCI {
     std::string     filename;                 // The filename for this object
     ESMC_FileStatus_Flag fileStatusFlag;      // Store file status
     bool            overwrite;                // OK to overwrite fields if true
+    IO_StorageOptions storageOptions;         // for variables created
   protected:
     IO_Handler(ESMC_IOFmt_Flag fmtArg);        // native constructor
   private:
@@ -83,6 +116,13 @@ namespace ESMCI {
                               ESMC_IOFmt_Flag iofmt, int *rc = NULL);
     static int destroy(IO_Handler **io);
     static void finalize(int *rc = NULL);
+    // Free cached I/O resources of an Array that is being destroyed
+    static void releaseArray(Array *arr_p);
+    // Storage options set by the ESMF_RUNTIME_IO_* environment variables
+    static IO_StorageOptions defaultStorageOptions(void);
+    // Round R4 or R8 data to nsb significant mantissa bits
+    static void bitRound(void *data, size_t count,
+                         ESMC_TypeKind_Flag typekind, int nsb);
   private:
     virtual void destruct(void) { }
   public:
@@ -100,6 +140,10 @@ namespace ESMCI {
                             const Attribute *varAttPack = NULL,
                             const Attribute *gblAttPack = NULL,
                             int *rc = NULL) = 0;
+    // Write several Arrays in order. Handlers that can aggregate the
+    // writes of Arrays with a common decomposition override this.
+    virtual void arrayWriteMulti(std::vector<IO_ArrayWriteItem> &items,
+                                 int *timeslice = NULL, int *rc = NULL);
 
     // get() and set()
   public:
@@ -111,6 +155,12 @@ namespace ESMCI {
     }
     const char *getFilename(void) const { return filename.c_str(); }
     bool overwriteFields(void) { return overwrite; }
+    const IO_StorageOptions &getStorageOptions(void) const {
+      return storageOptions;
+    }
+    void setStorageOptions(const IO_StorageOptions &options) {
+      storageOptions = options;
+    }
     ESMC_FileStatus_Flag getFileStatusFlag(void) { return fileStatusFlag; }
   protected:
     virtual void setFormat(ESMC_IOFmt_Flag *newIofmt) {
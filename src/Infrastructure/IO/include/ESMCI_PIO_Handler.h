@@ -39,6 +39,7 @@
 #include "ESMCI_IO_Handler.h"       // IO_Handler is superclass to PIO_Handler
 #include "mpi.h"
 
+#include <string>
 #include <vector>
 
 // PIO include files
@@ -92,6 +93,10 @@ namespace ESMCI {
 //                                   MPI_Comm *comp_comms, MPI_Comm io_comm,
 //                                   int *rc = NULL);
     static void finalize(int *rc = NULL);
+    // Complete all asynchronous I/O and stop the I/O thread
+    static void finalizeAsync(int *rc = NULL);
+    // Free the I/O descriptors of an Array that is being destroyed
+    static void releaseArray(Array *arr_p);
     // Be able to see if PIO is initialized
     static ESMC_Logical isPioInitialized(void);
     // Non-static member for default initialization
@@ -115,6 +120,8 @@ namespace ESMCI {
                     const Attribute *varAttPack = NULL,
                     const Attribute *gblAttPack = NULL,
                     int *rc = NULL);
+    void arrayWriteMulti(std::vector<IO_ArrayWriteItem> &items,
+                         int *timeslice = NULL, int *rc = NULL);
 
     // get() and set()
   public:
@@ -145,8 +152,35 @@ namespace ESMCI {
                             int ** arrdims = (int **)NULL,
                             int *narrDims = (int *)NULL,
                             int *basepiotype = (int *)NULL,
-                            int *rc = (int *)NULL);
+                            int *rc = (int *)NULL,
+                            int stackCount = 1);
+    // A variable defined in the file, waiting for its data to be written
+    struct DefinedWrite {
+      Array *array;
+      pio_io_desc_t iodesc;
+      pio_var_desc_t vardesc;             // owned until written
+      int basepiotype;
+      std::vector<int> arrDims;           // shape of the local data
+      std::string varname;
+    };
+    // The two halves of arrayWrite(): define mode and data mode
+    void arrayWriteDefine(Array *arr_p, const char * const name,
+                          const std::vector<std::string> &dimLabels,
+                          int *timeslice, const Attribute *varAttPack,
+                          const Attribute *gblAttPack, DefinedWrite &dw,
+                          int *rc = NULL);
+    void arrayWriteData(DefinedWrite &dw, int *rc = NULL);
+    // Write a group of Arrays with identical layout as one stacked variable
+    void arrayWriteStacked(std::vector<IO_ArrayWriteItem> &items,
+                           int first, int count, int *rc = NULL);
     void attPackPut (pio_var_desc_t vardesc, const Attribute *attPack, int *rc);
+    // Chunking and compression of a newly defined NetCDF-4 variable
+    void defineVarStorage(const std::string &varname, Array *arr_p,
+                          const int *ioDims, int nioDims, bool hasTime,
+                          int basepiotype, int *rc = NULL);
+    // Node-aware selection of the I/O PETs
+    static void ioTaskPlacement(VM *vm, int tasksPerNode,
+                                std::vector<int> &ioPets);
     // Error recording routine
     static bool CheckPIOError(int pioRetCode,
                               int line, const char * const file,
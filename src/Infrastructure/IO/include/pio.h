@@ -192,6 +192,10 @@ void pio_cpp_setnum_ost(pio_iosystem_desc_t *iosystem,
 
 int pio_cpp_file_is_open(pio_file_desc_t file);
 
+// subroutine pio_cpp_file_ncid(file, ncid, definer) bind(c)
+
+void pio_cpp_file_ncid(pio_file_desc_t file, int *ncid, int *definer);
+
 /////////////////////////////////
 //
 //  NetCDF Interface Functions
@@ -0,0 +1,82 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright 2002-2020, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+// ESMC asynchronous Log backend include file for C++
+
+#ifndef ESMCI_LOGASYNC_H
+#define ESMCI_LOGASYNC_H
+
+//-----------------------------------------------------------------------------
+//BOPI
+// !CLASS: ESMCI_LogAsync - asynchronous buffered backend of the default Log
+//
+// !DESCRIPTION:
+//
+// When enabled, log messages are copied into a per-thread single-producer
+// ring buffer and a background thread drains them to one file per compute
+// node.  All PETs of a node append whole batches of records to the same
+// file.  Network file systems don't make such appends atomic, so on them
+// each PET writes its own file instead.  Records are either formatted as text, identical to the regular
+// Log output, or stored in the binary format below and converted to text
+// by LogAsyncDecode() (see the ESMF_LogDecode application).
+//
+//EOPI
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <cstdio>
+#include <string>
+
+#define ESMC_LOGASYNC_MAGIC     0x474c5345  /* "ESLG" little endian */
+#define ESMC_LOGASYNC_RINGSIZE  (256*1024)  /* bytes per thread, power of 2 */
+#define ESMC_LOGASYNC_MAXMSG    4096        /* longer messages are truncated */
+
+// LogAsyncFilter() results
+#define ESMC_LOGASYNC_SKIP      0   /* message type not logged */
+#define ESMC_LOGASYNC_DIRECT    1   /* write through LogAsyncWrite() */
+#define ESMC_LOGASYNC_FULL      2   /* needs the full Log path (error, abort) */
+
+namespace ESMCI {
+
+  // binary record, followed by file, method and message bytes
+  struct LogAsyncRecord {
+    uint32_t magic;
+    int32_t  pet;
+    double   timestamp;    // seconds since the epoch
+    int32_t  line;         // <0 if not specified
+    int16_t  msgtype;      // ESMC_LogMsgType_Flag
+    uint8_t  noPrefix;
+    uint8_t  indentCount;
+    uint16_t fileLen;
+    uint16_t methodLen;
+    uint16_t msgLen;
+    uint16_t petDigits;    // width of the PET label
+  };
+
+  int LogAsyncOpen(const std::string &filename, int pet, int petCount,
+    bool binary);
+  bool LogAsyncIsOpen();
+  void LogAsyncSet(unsigned msgMask, unsigned abortMask, bool flushAlways,
+    int indentCount);
+  int LogAsyncFilter(int msgtype);
+  int LogAsyncGetIndentCount();
+  int LogAsyncWrite(const char *msg, size_t msgLen, int msgtype,
+    int line=-1, const char *file=NULL, size_t fileLen=0,
+    const char *method=NULL, size_t methodLen=0, int indentCount=0,
+    bool noPrefix=false);
+  int LogAsyncFlush();
+  int LogAsyncClose();
+  std::string LogAsyncGetFileName();
+  unsigned long LogAsyncGetDropCount();
+  int LogAsyncDecode(const std::string &filename, std::FILE *out);
+
+}
+
+#endif  //ESMCI_LOGASYNC_H
@@ -153,6 +153,7 @@ private:
     ESMC_LogKind_Flag logtype;
     int *errorMask;
     int errorMaskCount;
+    bool asyncFlag;             // default Log uses the asynchronous backend
 
 
   private:
@@ -0,0 +1,155 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright 2002-2020, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+// ESMCI KDTree include file for C++
+
+// (all lines below between the !BOP and !EOP markers will be included in
+//  the automated document processing.)
+//-------------------------------------------------------------------------
+// these lines prevent this file from being read more than once if it
+// ends up being included multiple times
+
+#ifndef ESMCI_KDTree_H
+#define ESMCI_KDTree_H
+
+#include <Mesh/include/Legacy/ESMCI_Exception.h>
+
+#include "PointList/include/ESMCI_PointList.h"
+
+#include <vector>
+
+//-------------------------------------------------------------------------
+//BOP
+// !CLASS: ESMCI_KDTree - KDTree
+//
+// !DESCRIPTION:
+//
+// A k-d tree over a set of points used to find the k nearest points
+// to each of a set of query points. The queries are answered in blocks
+// of at most KNN_BLOCK_SIZE points: a second tree is built over the
+// query points of a block and both trees are walked together (dual-tree
+// search), so that whole groups of query points are pruned against whole
+// groups of points at once. The subtrees of the query tree are
+// independent and are searched in parallel when OpenMP is available.
+// The results of a block are handed to a KDTreeNbrHandler before the
+// next block is searched, so the memory used by a search does not grow
+// with the number of query points.
+//
+// Points with the same distance are ordered by id, so the results are
+// the same as those of the OTree based nearest neighbor searches. If
+// several points have the same id only the first one is kept.
+//
+///EOP
+//-------------------------------------------------------------------------
+
+namespace ESMCI {
+
+// Distance used by the tree
+enum KDTREE_METRIC {
+  // Euclidean distance of the (2D or 3D) coordinates
+  KDTREE_METRIC_CART=0,
+  // Chord distance on the unit sphere: the 3D Cartesian coordinates are
+  // projected onto the unit sphere before measuring distances. For points
+  // already on the unit sphere (e.g. ESMF spherical grids) this is the
+  // same as KDTREE_METRIC_CART.
+  KDTREE_METRIC_CHORD=1
+};
+
+// Neighbor of a query point
+struct KDTreeNbr {
+  double dist2;  // distance squared
+  int id;        // id of point
+  int loc;       // location of point in the point list (or coord array)
+  double coord[3];
+
+  bool operator<(const KDTreeNbr &rhs) const {
+    if (dist2 != rhs.dist2) return dist2 < rhs.dist2;
+    return id < rhs.id;
+  }
+};
+
+// Receives the neighbors found by KDTree::knn()
+class KDTreeNbrHandler {
+ public:
+  virtual ~KDTreeNbrHandler() {}
+
+  // The num_nbrs neighbors of query point i, nearest first. nbrs is only
+  // valid during the call.
+  virtual void found(int i, int num_nbrs, const KDTreeNbr *nbrs) = 0;
+};
+
+class KDTree {
+
+ private:
+
+  // Nodes which make up tree
+  struct KDNode {
+    double min[3],max[3];
+    int beg, end;       // range of points in this node
+    int left, right;    // children, -1 if leaf
+  };
+
+  enum {LEAF_SIZE=16, KNN_BLOCK_SIZE=4096};
+
+  KDTREE_METRIC metric;
+
+  // Points, reordered so that the points of a node are contiguous
+  int num_pnts;
+  std::vector<double> coords;
+  std::vector<double> orig_coords;  // only used for KDTREE_METRIC_CHORD
+  std::vector<int> ids;
+  std::vector<int> locs;
+
+  std::vector<KDNode> nodes;
+
+  void build(const double *_coords, const int *_ids);
+  int build_node(int beg, int end);
+
+  struct Query;
+  void knn_block(int num_q, const double *q_coords, int k,
+                 const double *max_dist2, std::vector<KDTreeNbr> &nbrs,
+                 std::vector<int> &num_nbrs) const;
+  void dual_search(int qn, int rn, const KDTree &qtree, Query &q) const;
+  void base_case(int qn, int rn, const KDTree &qtree, Query &q) const;
+
+  static double box_dist2(const KDNode &a, const KDNode &b);
+  static double center_dist2(const KDNode &a, const KDNode &b);
+
+  // Hide copy
+  KDTree(const KDTree &);
+  KDTree &operator=(const KDTree &);
+
+ public:
+
+  // Build tree from the points in a PointList
+  KDTree(const PointList &pl, KDTREE_METRIC _metric=KDTREE_METRIC_CART);
+
+  // Build tree from num 3D points (coords has 3*num entries)
+  KDTree(int num, const double *_coords, const int *_ids,
+         KDTREE_METRIC _metric=KDTREE_METRIC_CART);
+
+  int get_num_pnts() const {return num_pnts;}
+
+  // Find the k nearest points to each of num_q query points (3D coords).
+  // Only points with distance squared <= max_dist2[i] are considered
+  // for query i (no limit if max_dist2 is NULL).
+  // handler.found() is called once for every query point, in order.
+  void knn(int num_q, const double *q_coords, int k, const double *max_dist2,
+           KDTreeNbrHandler &handler) const;
+
+  // Same as above for the points in a PointList
+  void knn(const PointList &q_pl, int k, const double *max_dist2,
+           KDTreeNbrHandler &handler) const;
+
+};  // end class KDTree
+
+} // END ESMCI namespace
+
+#endif  // ESMCI_KDTree_H
@@ -34,6 +34,9 @@ namespace ESMCI {
   bool intersect_quad_with_line(const double *q, const double *l1, const double *l2, double *p,
                                 double *t);
 
+  void intersect_quad_with_line_batch(int n, const double *q, const double *l1, const double *l2,
+                                      double *p, double *t, bool *ok);
+
   bool intersect_tri_with_line(const double *tri, const double *l1, const double *l2, double *p,
                                double *t);
 
@@ -38,6 +38,7 @@
     bool is_esmf_mesh;
     Mesh *mesh;     // Make 1 void pointer here for both
     void *mbmesh;
+    GridMeshRef *shared_mesh_ref; // reference to a Grid mesh cache mesh
 
     // NOT NEEDED RIGHT NOW
     //    bool is_internal_mesh_esmf() {return is_esmf_mesh;}
@@ -46,6 +47,7 @@
       is_esmf_mesh = false;
       mesh = NULL;
       mbmesh = NULL;
+      shared_mesh_ref = NULL;
       ESMC_BaseSetName(NULL, "Mesh");
     }
 
@@ -262,7 +264,7 @@
     static MeshCap *GridToMesh(const Grid &grid_, int staggerLoc,
                         const std::vector<ESMCI::Array*> &arrays,
                         ESMCI::InterArray<int> *maskValuesArg,
-                        int *regridConserve, int *rc);
+                        int *regridConserve, bool useCache, int *rc);
 
     static MeshCap *GridToMeshCell(const Grid &grid_,
                                    const std::vector<ESMCI::Array*> &arrays,
@@ -44,6 +44,12 @@ namespace ESMCI {
                       ESMCI::InterArray<int> *maskValuesArg,
                       int *regridConserve, Mesh **out_meshpp, int *rc);
 
+  void ESMCI_GridToMeshCached(const Grid &grid_, int staggerLoc,
+                      const std::vector<ESMCI::Array*> &arrays,
+                      ESMCI::InterArray<int> *maskValuesArg,
+                      int *regridConserve, Mesh **out_meshpp,
+                      GridMeshRef **out_refpp, int *rc);
+
   void ESMCI_GridToMeshCell(const Grid &grid_, 
                             const std::vector<ESMCI::Array*> &arrays, 
                             Mesh **out_meshpp, int *rc);
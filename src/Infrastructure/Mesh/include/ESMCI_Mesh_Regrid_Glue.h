@@ -36,6 +36,7 @@
 #include "Mesh/include/Regridding/ESMCI_ExtrapolationPoleLGC.h"
 #include "Mesh/include/ESMCI_MathUtil.h"
 #include "Mesh/include/Regridding/ESMCI_Regrid_Helper.h"
+#include "Mesh/include/Regridding/ESMCI_IncrRegrid.h"
 #include "ESMCI_PointList.h"
 
 //-----------------------------------------------------------------------------
@@ -68,6 +69,28 @@ void ESMCI_regrid_create(Mesh **meshsrcpp, ESMCI::Array **arraysrcpp, ESMCI::Poi
                          int *has_statusArray, ESMCI::Array **statusArray,
                          int*rc);
 
+// Update the weights wts of a point destination that moved since they
+// were generated, see online_regrid_update(), and store a new SMM
+// RouteHandle in rh from them.  The old RouteHandle in rh, if any, is
+// released.  On the first call wts and dst_boxes are empty and all rows
+// are generated.
+void ESMCI_regrid_update(Mesh **meshsrcpp, ESMCI::Array **arraysrcpp, ESMCI::PointList **plsrcpp,
+                         ESMCI::Array **arraydstpp, ESMCI::PointList **pldstpp,
+                         ESMCI::IWeights *wts, ESMCI::RegridDstBoxes *dst_boxes,
+                         int *regridMethod,
+                         int *map_type,
+                         int *regridPoleType, int *regridPoleNPnts,
+                         int *regridScheme,
+                         int *extrapMethod,
+                         int *extrapNumSrcPnts,
+                         ESMC_R8 *extrapDistExponent,
+                         int *extrapNumLevels,
+                         int *extrapNumInputLevels,
+                         int *unmappedaction,
+                         int *srcTermProcessing, int *pipelineDepth,
+                         ESMCI::RouteHandle **rh, int *num_updated,
+                         int*rc);
+
 void ESMCI_regrid_getiwts(Grid **gridpp,
                    Mesh **meshpp, ESMCI::Array **arraypp, int *staggerLoc,
                           int *regridScheme, int*rc);
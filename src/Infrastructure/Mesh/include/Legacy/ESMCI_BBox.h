@@ -15,6 +15,7 @@
 #include <Mesh/include/Legacy/ESMCI_MeshDB.h>
 #include <Mesh/include/Legacy/ESMCI_MeshObj.h>
 #include <Mesh/include/Legacy/ESMCI_MEField.h>  // for coords
+#include <Mesh/include/Legacy/ESMCI_MeshCSR.h>
 
 
 #include <Mesh/include/Legacy/ESMCI_MeshTypes.h>
@@ -42,8 +43,12 @@ BBox(UInt dim, const double min[], const double max[]);
 // will be expanded in the normal direction by normexp*diameter of object
  BBox(const MEField<> &coords, const MeshObj &obj, double normexp = 0.0, bool is_sph=false);
 
+// Same as above for element e of the compact connectivity
+ BBox(const MeshCSR &csr, UInt e, double normexp = 0.0, bool is_sph=false);
+
 // Build a box around the whole mesh.  Not a cheap operation (loops nodes)
  BBox(const MEField<> &coords, const MeshDB &mesh, bool is_sph=false);
+ BBox(const MeshCSR &csr, bool is_sph=false);
 
 BBox(_field &coords, const MeshDB &mesh);
 
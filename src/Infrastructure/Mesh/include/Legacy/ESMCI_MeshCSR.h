@@ -0,0 +1,80 @@
+// $Id$
+// Earth System Modeling Framework
+// Copyright 2002-2020, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+//
+//-----------------------------------------------------------------------------
+#ifndef ESMCI_MeshCSR_h
+#define ESMCI_MeshCSR_h
+
+#include <Mesh/include/Legacy/ESMCI_MeshDB.h>
+#include <Mesh/include/Legacy/ESMCI_MeshObj.h>
+#include <Mesh/include/Legacy/ESMCI_MeshObjTopo.h>
+#include <Mesh/include/Legacy/ESMCI_MEField.h>
+#include <Mesh/include/Legacy/ESMCI_MeshTypes.h>
+
+#include <vector>
+#include <cstddef>
+
+namespace ESMCI {
+
+/**
+ * Compact element to node connectivity of the active elements of a MeshDB.
+ * Elements are numbered 0..n-1 in the order of MeshDB::elem_begin(), their
+ * nodes are stored in CSR form (offset + index arrays) and the node
+ * coordinates in one contiguous array.  Loops that only need the element
+ * topology and the node coordinates, such as the bounding boxes of the
+ * search, run over these flat arrays instead of following the relation
+ * lists and field pointers of every MeshObj.
+ *
+ * The coordinate field must be nodal with one function per element node,
+ * as it is for all meshes built by ESMF.  The connectivity is a snapshot;
+ * it must be rebuilt if the mesh is modified.
+ * @ingroup meshdatabase
+ */
+class MeshCSR {
+public:
+  MeshCSR(const MeshDB &mesh, const MEField<> &coords);
+
+  UInt num_nodes() const { return coord.size()/sdim; }
+  UInt num_elems() const { return elem_ptr.size(); }
+  UInt spatial_dim() const { return sdim; }
+
+  // Element -> node connectivity (node indices in topological order)
+  UInt elem_num_nodes(UInt e) const { return elem_node_off[e+1]-elem_node_off[e]; }
+  const UInt *elem_nodes(UInt e) const { return &elem_node[elem_node_off[e]]; }
+
+  // Coordinates of node n (spatial_dim() values)
+  const double *node_coords(UInt n) const { return &coord[n*sdim]; }
+
+  const MeshObjTopo *elem_topo(UInt e) const { return elem_tp[e]; }
+
+  // Back pointer into the MeshDB
+  const MeshObj *elem_obj(UInt e) const { return elem_ptr[e]; }
+
+  // Number of bytes held by the connectivity
+  std::size_t memory_bytes() const;
+
+private:
+  MeshCSR(const MeshCSR &);
+  MeshCSR &operator=(const MeshCSR &);
+
+  UInt sdim;
+
+  std::vector<const MeshObj*> elem_ptr;
+  std::vector<const MeshObjTopo*> elem_tp;
+
+  std::vector<UInt> elem_node_off;
+  std::vector<UInt> elem_node;
+
+  std::vector<double> coord;
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,112 @@
+// $Id$
+// Earth System Modeling Framework
+// Copyright 2002-2020, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+//
+//-----------------------------------------------------------------------------
+#ifndef ESMCI_IncrRegrid_h
+#define ESMCI_IncrRegrid_h
+
+#include <Mesh/include/ESMCI_Mesh.h>
+#include <PointList/include/ESMCI_PointList.h>
+#include <Mesh/include/Legacy/ESMCI_BBox.h>
+#include <Mesh/include/Regridding/ESMCI_Interp.h>
+
+#include <vector>
+#include <utility>
+
+namespace ESMCI {
+
+/**
+ * Bounding boxes of the locally owned destination objects that a weight
+ * matrix was generated for.  For point destinations (PointList) the box
+ * of a point is the point itself, for Mesh destinations it is the box
+ * around the element's nodes.  Comparing a snapshot against the current
+ * destination tells which weight matrix rows are out of date after the
+ * destination has moved or been adapted.
+ */
+class RegridDstBoxes {
+public:
+  // Boxes which differ by more than tol in any coordinate are changed
+  RegridDstBoxes(double _tol = 0.0) : tol(_tol) {}
+
+  // Record the boxes of the destination objects.  Exactly one of
+  // dstmesh (elements) and dstpointlist (points) is used, the point list
+  // if both are given.
+  void set(Mesh *dstmesh, PointList *dstpointlist);
+
+  // Compare the current destination against the recorded boxes.
+  // changed_ids gets the ids of objects which are new or whose box
+  // changed, removed_ids the ids of recorded objects which are no
+  // longer part of the destination.  Both are sorted.
+  void diff(Mesh *dstmesh, PointList *dstpointlist,
+            std::vector<UInt> &changed_ids,
+            std::vector<UInt> &removed_ids) const;
+
+  UInt size() const { return boxes.size(); }
+
+  void clear() { boxes.clear(); }
+
+private:
+  typedef std::pair<UInt, BBox> id_box;
+
+  static void get_boxes(Mesh *dstmesh, PointList *dstpointlist,
+                        std::vector<id_box> &out);
+
+  bool same(const BBox &b1, const BBox &b2) const;
+
+  double tol;
+
+  // sorted by id
+  std::vector<id_box> boxes;
+};
+
+// Update the weight matrix wts (and dst_status if set_dst_status), which
+// was generated by online_regrid() for the destination recorded in
+// dst_boxes, to the current state of the destination.  On return
+// dst_boxes describes the current destination.
+//
+// The regridding arguments are those of online_regrid() and must be the
+// ones used to generate wts.  The source must also be in the state it was
+// for the original generation (e.g. recreated from the same Grid), since
+// some methods add poles or ghost elements to the source Mesh.
+//
+// Only point destinations (PointList) regridded without conservation,
+// nearest dst to src or creep fill extrapolation are updated
+// incrementally: the rows of points whose position changed are searched
+// for and recomputed, they are merged into wts replacing the old rows,
+// and the rows of points which left the destination are removed.  Rows
+// of other destinations and methods depend on one another, so for those
+// the whole matrix is regenerated, at the cost of online_regrid().
+//
+// This doesn't touch any RouteHandle: the XXE stream of a RouteHandle has
+// no notion of a single matrix row.  ESMCI_regrid_update() calls this and
+// stores a new RouteHandle from the updated weights.
+//
+// num_updated is set to the number of locally updated rows, or -1 if the
+// whole matrix was regenerated.  Collective over the PETs of the mesh.
+int online_regrid_update(Mesh *srcmesh, PointList *srcpointlist,
+                         Mesh *dstmesh, PointList *dstpointlist,
+                         RegridDstBoxes &dst_boxes,
+                         IWeights &wts,
+                         int *regridConserve, int *regridMethod,
+                         int *regridPoleType, int *regridPoleNPnts,
+                         int *regridScheme,
+                         int *map_type,
+                         int *extrapMethod,
+                         int *extrapNumSrcPnts,
+                         ESMC_R8 *extrapDistExponent,
+                         int *extrapNumLevels,
+                         int *extrapNumInputLevels,
+                         int *unmappedaction,
+                         bool set_dst_status, WMat &dst_status,
+                         int *num_updated);
+
+} // namespace
+
+#endif
@@ -18,6 +18,7 @@
 #include <Mesh/include/Regridding/ESMCI_ShapeFunc.h>
 
 #include <string>
+#include <limits>
 
 namespace ESMCI {
 
@@ -70,6 +71,30 @@ public:
                         double *pcoord,
                         double *dist = NULL) const = 0;
 
+  /**
+   * Batched is_in_cell for n (cell, point) pairs.
+   * mdata = mapping data of the cells, cell i starts at mdata+i*mdata_stride
+   * points = points to test, 3 doubles per point
+   * pcoords = parametric coordinates returned, 3 doubles per point
+   * dists, ins = distance and is in flag (0 or 1) returned, 1 entry per point
+   * The default just calls is_in_cell on each pair; mappings that can
+   * do better override it.
+   */
+  virtual void is_in_cell_batch(UInt n,
+                                const double *mdata,
+                                UInt mdata_stride,
+                                const double *points,
+                                double *pcoords,
+                                double *dists,
+                                char *ins) const {
+    for (UInt i = 0; i < n; ++i) {
+      double *pcoord = pcoords+3*i;
+      pcoord[0] = pcoord[1] = pcoord[2] = 0.0;
+      dists[i] = std::numeric_limits<double>::max();
+      ins[i] = is_in_cell(mdata+i*mdata_stride, points+3*i, pcoord, dists+i);
+    }
+  }
+
   /**
    * Dimension of the range of the mapping.
    */
@@ -321,6 +346,14 @@ public:
                         double *pcoord,
                         double *dist = NULL) const;
 
+  void is_in_cell_batch(UInt n,
+                        const double *mdata,
+                        UInt mdata_stride,
+                        const double *points,
+                        double *pcoords,
+                        double *dists,
+                        char *ins) const;
+
   void forward(const unsigned int npts,
                const mdata_type mdata[],
                const pcoord_type points[],
@@ -39,6 +39,8 @@ namespace ESMCI {
 #include "ESMCI_Base.h"       // Base is superclass to RouteHandle
 #include "ESMCI_Array.h"
 
+#include <vector>
+
 //-------------------------------------------------------------------------
 
 //-------------------------------------------------------------------------
@@ -59,6 +61,12 @@ namespace ESMCI {
     ESMC_ARRAYBUNDLEXXE
   }RouteHandleType;
 
+  // store method under which a RouteHandle is held in the RouteHandle cache
+  typedef enum {
+    ESMC_RHCACHE_HALO=1,
+    ESMC_RHCACHE_REDIST
+  }RouteHandleCacheKind;
+
   // class definition
   class RouteHandle : public ESMC_Base {    // inherits from ESMC_Base class
     
@@ -72,6 +80,8 @@ namespace ESMCI {
     //TODO: Arrays to persist
     Array *srcArray;
     Array *dstArray;
+    ESMC_I8 srcFingerprint; // content based fingerprint of srcArray layout
+    ESMC_I8 dstFingerprint; // content based fingerprint of dstArray layout
     char *asPtr;    // attached state pointer, used to carry Fortran info around
     void *srcMaskValue;
     void *dstMaskValue;
@@ -89,6 +99,7 @@ namespace ESMCI {
     static RouteHandle *create(RouteHandle *rh, InterArray<int> *originPetList,
       InterArray<int> *targetPetList, int *rc);
     static RouteHandle *create(const std::string &file, int *rc);
+    static RouteHandle *copy(RouteHandle *rh, int *rc);
     static int destroy(RouteHandle *routehandle, bool noGarbage=false);
     int construct(void);
     int destruct(void);
@@ -156,11 +167,20 @@ namespace ESMCI {
     }
         
     // fingerprinting of src/dst Arrays
-    int fingerprint(Array *srcArrayArg, Array *dstArrayArg){
-      srcArray = srcArrayArg;
-      dstArray = dstArrayArg;
-      return ESMF_SUCCESS;
-    }
+    int fingerprint(Array *srcArrayArg, Array *dstArrayArg);
+    ESMC_I8 getSrcFingerprint() const { return srcFingerprint; }
+    ESMC_I8 getDstFingerprint() const { return dstFingerprint; }
+    static ESMC_I8 hash(std::vector<ESMC_I8> const &content);
+
+    // process-wide cache of precomputed RouteHandles
+    static bool cacheEnabled();
+    static RouteHandle *cacheGet(std::vector<ESMC_I8> const &key,
+      int *pipelineDepthArg, int *rc=NULL);
+    static int cacheAdd(std::vector<ESMC_I8> const &key,
+      RouteHandle *rh, int const *pipelineDepthArg);
+    static void cacheRelease(RouteHandle const *rh);
+    static int cacheGetCount();
+    static void cacheFinalize();
         
     // required methods inherited and overridden from the ESMC_Base class
     int validate() const;
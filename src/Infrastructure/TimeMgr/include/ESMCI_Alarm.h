@@ -151,7 +151,16 @@ class Alarm {
                                   //   because int is atomic.
                                   //    TODO: inherit from ESMC_Base class
 
-//    bool              pad1;       //  TODO:  align on byte boundary
+    // bookkeeping for the associated clock's alarm schedule
+    ESMC_I8           lastCheckCount;  // clock->alarmCheckCount when this
+                                       //   alarm was last checked
+    ESMC_I8           clockSlot;       // orders alarms as in clock's
+                                       //   alarmList
+    unsigned int      scheduleVersion; // invalidates stale schedule entries
+    bool              scheduleDue;     // on clock's list of alarms to check
+                                       //   on the next advance
+
+//    bool              pad1;      //  TODO:  align on byte boundary
 
 //    pthread_mutex_t   alarmMutex; // TODO: (TMG 7.5)
 
@@ -272,6 +281,17 @@ class Alarm {
     // reconstruct ringBegin during ESMF_DIRECTION_REVERSE
     int resetRingBegin(bool timeStepPositive);
 
+    // ringingOnPrevTimeStep, accounting for clock timesteps on which the
+    // clock's alarm schedule skipped checkRingTime() for this alarm
+    bool prevRingingState(void) const;
+
+    // apply the effect of skipped checks up to the given clock check count
+    void settle(ESMC_I8 checkCount);
+
+    // settle, then have the clock check this alarm on its next advance;
+    // called before any change to the alarm's ringing properties
+    void reschedule(void);
+
     // friend class alarm
     friend class Clock;
 
@@ -53,8 +53,8 @@
 // defined for advancing the clock (perform a time step), checking if the
 // stop time is reached, synchronizing with a real-time clock, and getting
 // values of the class attributes defined above. After performing the time
-// step, the advance method will iterate over the alarm list and return a
-// list of any active alarms.
+// step, the advance method will check the alarms that are ringing or whose
+// ring time has been reached, and return a list of any active alarms.
 //
 // Notes:
 //    TMG 3.2:  Create multiple clocks by simply instantiating this class
@@ -69,11 +69,22 @@
 #include "ESMCI_Time.h"
 #include "ESMCI_Alarm.h"
 
+#include <string>
+#include <vector>
+#include <unordered_map>
+
 namespace ESMCI{
 
 // !PUBLIC TYPES:
  class Clock;
 
+ // entry of a clock's alarm schedule (min-heap on ringTime)
+ struct ClockAlarmEntry {
+   Time          ringTime;  // alarm's ringTime when scheduled
+   Alarm        *alarm;
+   unsigned int  version;   // valid if equal to alarm->scheduleVersion
+ };
+
 // !PRIVATE TYPES:
  // class configuration type:  not needed for Clock
 
@@ -111,6 +122,20 @@ namespace ESMCI{
                                                 //  necessary
     Alarm           **alarmList;                // associated alarm array
 
+    // Alarm schedule: only alarms on the alarmsDue list, or whose ringTime
+    // has been reached, are checked by advance().  Quiet alarms wait in
+    // alarmSchedule, a min-heap on their next ringTime.
+    ESMC_I8           alarmCheckCount;  // number of alarm checking passes
+    ESMC_I8           alarmSlotCount;   // number of alarms ever added
+    std::vector<ClockAlarmEntry> alarmSchedule;
+    std::vector<Alarm*> alarmsDue;
+    bool              alarmScheduleValid; // false: check all alarms on the
+                                          //   next advance
+
+    // alarm name -> first alarm of that name in alarmList
+    std::unordered_map<std::string, Alarm*> alarmNameIndex;
+    bool              alarmNameIndexValid;
+
     bool              stopTimeEnabled;  // true if optional property set
 
     int               id;         // unique identifier. used for equality
@@ -261,6 +286,11 @@ namespace ESMCI{
     int addAlarm(Alarm *alarm);    // alarmCreate(), alarmSet() (TMG 4.1, 4.2)
     int removeAlarm(Alarm *alarm); // alarmDestroy(), alarmSet()
 
+    // check given alarm on next advance; Alarm::reschedule(), addAlarm()
+    void scheduleAlarm(Alarm *alarm);
+    // drop the alarm schedule, all alarms are checked on the next advance
+    void resetAlarmSchedule(void);
+
     friend class Alarm;
 
 //
@@ -31,7 +31,7 @@ public:
     {
     }
 
-    K getKey() const
+    const K &getKey() const
     {
         return _key;
     }
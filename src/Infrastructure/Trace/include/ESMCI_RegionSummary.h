@@ -12,11 +12,14 @@
 #define ESMCI_REGIONSUMMARY_H
 
 #include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <vector>
 #include <math.h>
 #include <algorithm>
 #include <string>
 #include <stdexcept>
+#include <sstream>
 
 #include "ESMCI_LogErr.h"
 
@@ -35,9 +38,22 @@ namespace ESMCI {
   RegionSummary(RegionSummary *parent):
     _parent(parent), _name(""),
       _pet_count(0), _count_each(0), _counts_match(true),
-      _total_sum(0),
+      _total_sum(0), _total_m2(0.0),
       _total_min(UINT64T_BIG), _total_min_pet(-1),
       _total_max(0), _total_max_pet(-1) {}
+
+    /*
+     * Create a summary tree from a buffer produced by serialize()
+     */
+  RegionSummary(char *deserializeBuffer, size_t bufferSize):
+    _parent(NULL), _name(""),
+      _pet_count(0), _count_each(0), _counts_match(true),
+      _total_sum(0), _total_m2(0.0),
+      _total_min(UINT64T_BIG), _total_min_pet(-1),
+      _total_max(0), _total_max_pet(-1) {
+      size_t offset = 0;
+      deserialize(deserializeBuffer, &offset, bufferSize);
+    }
     
     ~RegionSummary() {
       while (!_children.empty()) {
@@ -104,6 +120,18 @@ namespace ESMCI {
       }
     }
 
+    /*
+     * Standard deviation of the totals over the reporting PETs
+     */
+    double getTotalStdDev() const {
+      if (_pet_count > 0) {
+        return sqrt(_total_m2 / _pet_count);
+      }
+      else {
+        return 0.0;
+      }
+    }
+
     uint64_t getTotalMin() const {
       return _total_min;
     }
@@ -155,6 +183,9 @@ namespace ESMCI {
      */
     void merge(const RegionNode &rn, int pet) {
 
+      //running variance update (Welford)
+      double delta = rn.getTotal() - getTotalMeanExact();
+
       _pet_count++;
       if (_pet_count == 1) {
 	_count_each = rn.getCount();
@@ -164,6 +195,7 @@ namespace ESMCI {
       }
          
       _total_sum += rn.getTotal();
+      _total_m2 += delta * (rn.getTotal() - getTotalMeanExact());
       if (_total_min > rn.getTotal()) {
 	_total_min = rn.getTotal();
 	_total_min_pet = pet;
@@ -177,8 +209,174 @@ namespace ESMCI {
       mergeChildren(rn, pet);
     }
 
+    /*
+     * Add the timings of another summary, covering a disjoint
+     * set of PETs, to the summary.  The result is the same as
+     * merging all the PET timings into a single summary, with
+     * ties for min and max PET going to the lower PET.
+     */
+    void merge(const RegionSummary &other) {
+
+      if (other._pet_count > 0) {
+        if (_pet_count == 0) {
+          _count_each = other._count_each;
+          _counts_match = other._counts_match;
+        }
+        else if (!other._counts_match || _count_each != other._count_each) {
+          _counts_match = false;
+        }
+
+        //pairwise variance update (Chan et al.)
+        double n_a = _pet_count;
+        double n_b = other._pet_count;
+        double delta = other.getTotalMeanExact() - getTotalMeanExact();
+        _total_m2 += other._total_m2 + delta * delta * n_a * n_b / (n_a + n_b);
+
+        _pet_count += other._pet_count;
+        _total_sum += other._total_sum;
+
+        if (other._total_min < _total_min ||
+            (other._total_min == _total_min && other._total_min_pet >= 0 &&
+             (_total_min_pet < 0 || other._total_min_pet < _total_min_pet))) {
+          _total_min = other._total_min;
+          _total_min_pet = other._total_min_pet;
+        }
+        if (other._total_max > _total_max ||
+            (other._total_max == _total_max && other._total_max_pet >= 0 &&
+             (_total_max_pet < 0 || other._total_max_pet < _total_max_pet))) {
+          _total_max = other._total_max;
+          _total_max_pet = other._total_max_pet;
+        }
+      }
+
+      //recursively merge child nodes
+      for (unsigned i = 0; i < other._children.size(); i++) {
+	RegionSummary *child = getOrAddChild(other._children.at(i)->getName());
+	child->merge(*(other._children.at(i)));
+      }
+    }
+
+    /*
+     * Serialize the summary tree into a newly allocated
+     * buffer, which must be freed by the caller
+     */
+    char *serialize(size_t *bufSize) const {
+      size_t bufferSize = serializeSize();
+      if (bufSize != NULL) *bufSize = bufferSize;
+
+      char *buffer = (char *) malloc(bufferSize);
+      if (buffer==NULL) {
+        throw std::bad_alloc();
+      }
+      memset(buffer, 0, bufferSize);
+
+      size_t offset = 0;
+      serialize(buffer, &offset);
+      return buffer;
+    }
+
   private:
 
+    double getTotalMeanExact() const {
+      if (_pet_count > 0) {
+	return (double) _total_sum / _pet_count;
+      }
+      else {
+	return 0.0;
+      }
+    }
+
+    /*
+     * Fixed size part of a serialized node: pet count, count each,
+     * counts match, sum, m2, min, min pet, max, max pet,
+     * name size and number of children
+     */
+    static size_t localSerializeSize() {
+      return sizeof(size_t) + sizeof(size_t) + sizeof(int) +
+        sizeof(uint64_t) + sizeof(double) +
+        sizeof(uint64_t) + sizeof(int) + sizeof(uint64_t) + sizeof(int) +
+        sizeof(size_t) + sizeof(size_t);
+    }
+
+    size_t serializeSize() const {
+      size_t s = localSerializeSize() + _name.length();
+      for (unsigned i = 0; i < _children.size(); i++) {
+	s += _children.at(i)->serializeSize();
+      }
+      return s;
+    }
+
+    template <typename T>
+    static void pack(char *buffer, size_t *offset, const T &val) {
+      memcpy(buffer+(*offset), (const void *) &val, sizeof(T));
+      *offset += sizeof(T);
+    }
+
+    template <typename T>
+    static void unpack(char *buffer, size_t *offset, size_t bufferSize, T &val) {
+      if (*offset + sizeof(T) > bufferSize) {
+        std::stringstream errMsg;
+        errMsg << "Buffer too small to deserialize region summary: ";
+        errMsg << "buffer size = " << bufferSize;
+        errMsg << " expected: " << (*offset + sizeof(T));
+        throw std::runtime_error(errMsg.str());
+      }
+      memcpy((void *) &val, buffer+(*offset), sizeof(T));
+      *offset += sizeof(T);
+    }
+
+    /* pre-order, each node followed by its children */
+    void serialize(char *buffer, size_t *offset) const {
+      int countsMatch = _counts_match ? 1 : 0;
+      size_t nameSize = _name.length();
+      size_t childCount = _children.size();
+      pack(buffer, offset, _pet_count);
+      pack(buffer, offset, _count_each);
+      pack(buffer, offset, countsMatch);
+      pack(buffer, offset, _total_sum);
+      pack(buffer, offset, _total_m2);
+      pack(buffer, offset, _total_min);
+      pack(buffer, offset, _total_min_pet);
+      pack(buffer, offset, _total_max);
+      pack(buffer, offset, _total_max_pet);
+      pack(buffer, offset, nameSize);
+      pack(buffer, offset, childCount);
+      if (nameSize > 0) {
+        memcpy(buffer+(*offset), (const void *) _name.c_str(), nameSize);
+        *offset += nameSize;
+      }
+      for (unsigned i = 0; i < _children.size(); i++) {
+	_children.at(i)->serialize(buffer, offset);
+      }
+    }
+
+    void deserialize(char *buffer, size_t *offset, size_t bufferSize) {
+      int countsMatch = 1;
+      size_t nameSize = 0;
+      size_t childCount = 0;
+      unpack(buffer, offset, bufferSize, _pet_count);
+      unpack(buffer, offset, bufferSize, _count_each);
+      unpack(buffer, offset, bufferSize, countsMatch);
+      unpack(buffer, offset, bufferSize, _total_sum);
+      unpack(buffer, offset, bufferSize, _total_m2);
+      unpack(buffer, offset, bufferSize, _total_min);
+      unpack(buffer, offset, bufferSize, _total_min_pet);
+      unpack(buffer, offset, bufferSize, _total_max);
+      unpack(buffer, offset, bufferSize, _total_max_pet);
+      unpack(buffer, offset, bufferSize, nameSize);
+      unpack(buffer, offset, bufferSize, childCount);
+      _counts_match = (countsMatch != 0);
+      if (*offset + nameSize > bufferSize) {
+        throw std::runtime_error("Buffer too small to deserialize region summary name.");
+      }
+      _name = string(buffer+(*offset), nameSize);
+      *offset += nameSize;
+      for (size_t i = 0; i < childCount; i++) {
+        RegionSummary *child = addChild("");
+        child->deserialize(buffer, offset, bufferSize);
+      }
+    }
+
     void mergeChildren(const RegionNode &other, int pet) {
       for (unsigned i = 0; i < other.getChildren().size(); i++) {
 	RegionSummary *child = getOrAddChild(other.getChildren().at(i)->getName());
@@ -202,6 +400,7 @@ namespace ESMCI {
     size_t _count_each;      //count on each PET (typically these will match)
     bool _counts_match;      //whether the counts all match
     uint64_t _total_sum;     //sum of all totals
+    double   _total_m2;      //sum of squared deviations of totals from mean
     uint64_t _total_min;     //min of all totals
     int      _total_min_pet; //PET with min total
     uint64_t _total_max;     //max of all totals
@@ -59,6 +59,7 @@ namespace ESMCI {
 
   void TraceInitializeClock(int *rc);
   uint64_t TraceGetClock(void *data);
+  uint64_t TraceClockNow();
   void TraceClockLatch(struct esmftrc_platform_filesys_ctx *ctx);
   void TraceClockUnlatch(struct esmftrc_platform_filesys_ctx *ctx);
   void TraceOpen(std::string trace_dir, int *profileToLog, int *rc);
@@ -30,8 +30,8 @@
 #endif
 
 namespace ESMCI { 
-  void TraceEventRegionEnter(std::string name, int *rc);
-  void TraceEventRegionExit(std::string name, int *rc);
+  void TraceEventRegionEnter(const std::string &name, int *rc);
+  void TraceEventRegionExit(const std::string &name, int *rc);
   void TraceEventCompPhaseEnter(ESMCI::Comp *comp, enum ESMCI::method *method, int *phase, int *rc);
   void TraceEventCompPhaseExit(ESMCI::Comp *comp, enum ESMCI::method *method, int *phase, int *rc);
 }
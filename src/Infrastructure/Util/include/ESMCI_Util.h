@@ -92,7 +92,8 @@ enum ESMC_CommFlag { ESMF_COMM_BLOCKING=0,
                      ESMF_COMM_NBSTART,
                      ESMF_COMM_NBTESTFINISH,
                      ESMF_COMM_NBWAITFINISH,
-                     ESMF_COMM_CANCEL};
+                     ESMF_COMM_CANCEL,
+                     ESMF_COMM_NBWAITANYFINISH};
 
 // Attribute reconcile type
 enum ESMC_AttCopyFlag { ESMF_ATTCOPY_REFERENCE=0,
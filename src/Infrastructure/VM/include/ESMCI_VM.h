@@ -83,6 +83,7 @@ namespace ESMCI {
 // void VMIdDestroy(VMId *vmID, int *rc); // frees memory for vmKey memb
 bool VMIdCompare(VMId *vmID1, VMId *vmID2);
 int VMIdCopy(VMId *vmIDdst, VMId *vmIDsrc);
+std::size_t VMIdHash(VMId *vmID);
 // void VMIdGet(VMId *vmID, int *localID, char *key, int key_len, int *rc);
 // void VMIdSet(VMId *vmID, int  localID, char *key, int key_len, int *rc);
 } // namespace ESMCI
@@ -138,6 +139,7 @@ class VM : public VMK {   // inherits from ESMCI::VMK class
     static int getBaseIDAndInc(VMId *vmID);
     static void addObject(ESMC_Base *, VMId *vmID);
     static void rmObject(ESMC_Base *);
+    static void reindexObject(ESMC_Base *);
     static void addFObject(void **fobject, int objectID, VMId *vmID);
     static void getObject(void **fobject,
       int objectID, VMId *vmID, const std::string &name, ESMC_ProxyFlag proxyflag,
@@ -19,6 +19,7 @@
 
 #include <mpi.h>
 #include <vector>
+#include <atomic>
 
 #ifdef VMK_STANDALONE
 #include <pthread.h>
@@ -68,6 +69,12 @@ enum vmType { vmBYTE=1, vmI4, vmI8, vmR4, vmR8, vmL4};
 // - number of shared memory non-blocking channels
 #define SHARED_NONBLOCK_CHANNELS      (16)
 
+// - chunk size in bytes for pipelined hierarchical collectives
+#define HIERCOLL_CHUNK                (262144)
+
+// - default capacity in bytes of the intra-process ring buffer channels
+#define SHARED_RING_CAPACITY          (65536)
+
 // begin sync stuff -----
 #define SYNC_NBUFFERS                 (2)
 typedef struct{
@@ -148,6 +155,8 @@ class VMK{
     char buffer[2][PIPC_BUFFER];
   };
 
+  struct shared_ring;  // lock-free ring buffer, defined in ESMCI_VMKernel.C
+
   struct shared_mp{
     // source and destination pointers
     volatile const void *ptr_src;
@@ -162,6 +171,9 @@ class VMK{
     shmsync shms;
     // buffer for small messages
     char buffer[SHARED_BUFFER];
+    // ring buffer carrying all messages (SHMHACK), allocated on first use
+    int ringCapacity;   // capacity of the ring, 0 if not used
+    std::atomic<shared_ring *> ring;
     // Pthread sync variables
     esmf_pthread_mutex_t mutex1;
     esmf_pthread_cond_t cond1;
@@ -207,6 +219,18 @@ class VMK{
 #if !(defined ESMF_NO_MPI3 || defined ESMF_MPIUNI)
     MPI_Comm mpi_c_ssi; // communicator holding PETs on the same SSI
 #endif
+    // Hierarchical collectives (MPI-only VMs): PETs are grouped by SSI, the
+    // first PET of each group is the group's leader
+    int hierCollState;    // -1: not set up, 0: flat, 1: hierarchical
+    int hierCollSetupGroupPetCount; // hierCollGroupPetCount used in set up
+#if !(defined ESMF_NO_MPI3 || defined ESMF_MPIUNI)
+    MPI_Comm mpi_c_hier_local;    // PETs in the same group
+    MPI_Comm mpi_c_hier_leaders;  // leaders of all groups, valid on leaders
+#endif
+    int hierLocalRank;        // rank of localPet in mpi_c_hier_local
+    int hierGroupCount;       // number of groups
+    int *hierGroupOfPet;      // group of each PET, i.e. leader rank
+    int *hierLocalRankOfPet;  // rank of each PET within its group
     // Shared mutex and thread_finish variables. These are pointers that will be
     // pointing to shared memory variables between different thread-instances of
     // the VMK object.
@@ -232,6 +256,13 @@ class VMK{
     static int *cpuid;  // cpuid associated with certain core (multi-core cpus)
     static int *ssiid;    // single system image id to which this core belongs
     static double wtime0; // the MPI WTime at the very beginning of execution
+    // hierarchical collectives: 0: use if there are multiple SSIs with
+    // multiple PETs, <0: never use, >0: always use with groups of at most
+    // this many PETs on each SSI
+    static int hierCollGroupPetCount;
+    // capacity in bytes of the ring buffers of new intra-process channels,
+    // 0: use the small message buffer and pointer handoff instead
+    static int sharedRingCapacity;
   public:
     // Declaration of static data members - Definitions are in the header of
     // source file ESMF_VMKernel.C
@@ -265,6 +296,15 @@ class VMK{
     void obtain_args();
     void commqueueitem_link(commhandle *commh);
     int  commqueueitem_unlink(commhandle *commh);
+    bool hierCollActive();
+    void hierCollFree();
+#if !(defined ESMF_NO_MPI3 || defined ESMF_MPIUNI)
+    int hierAllreduce(void *in, void *out, int len, MPI_Datatype mpitype,
+      MPI_Op mpiop);
+    int hierAllgatherv(void *in, int inCount, void *out, int *outCounts,
+      int *outOffsets, MPI_Datatype mpitype);
+    int hierBroadcast(void *data, int len, int root);
+#endif
   public:
     void init(MPI_Comm mpiCommunicator=MPI_COMM_WORLD);
       // initialize the physical machine and a default (all MPI) virtual machine
@@ -286,6 +326,13 @@ class VMK{
     void shutdown(class VMKPlan *vmp, void *arg);
       // exit a vm derived from current vm according to the VMKPlan
   
+    static void setHierCollGroupPetCount(int count)
+      {hierCollGroupPetCount = count;}
+    static int getHierCollGroupPetCount(){return hierCollGroupPetCount;}
+    static void setSharedRingCapacity(int capacity)
+      {sharedRingCapacity = capacity;}
+    static int getSharedRingCapacity(){return sharedRingCapacity;}
+
     void print() const;
     
     // get() calls    <-- to be replaced by following new inlined section
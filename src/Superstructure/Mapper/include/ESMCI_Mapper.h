@@ -61,6 +61,19 @@ namespace ESMCI{
       bool get_optimal(std::vector<int> &opt_npets,
                     std::vector<std::pair<int, int> > &opt_pet_ranges,
                     double &opt_wtime);
+      /* Add per component timings from an ESMF profile summary
+       * (ESMF_Profile.summary) written by the Trace subsystem for a run
+       */
+      bool add_profile(const std::string &profile_fname);
+      /* Find the best sequential or concurrent PET layout on npets PETs
+       * for the components in the profiles added, using scaling curves
+       * fit to their timings. The recommended petlist configuration is
+       * written to petlist_fname, if provided, for the next run
+       */
+      bool optimize_layout(int npets, std::vector<std::string> &comp_names,
+                    std::vector<std::pair<int, int> > &opt_pet_ranges,
+                    double &opt_wtime,
+                    const std::string &petlist_fname = std::string());
       ~Mapper();
     private:
       ESMCI::VM &vm_;
@@ -76,6 +89,7 @@ namespace ESMCI{
       MapperUtil::LoadBalancer<double> lb_;
       std::string rseq_fname_;
       MapperUtil::RunSeqDGraph rseq_dgraph_;
+      MapperUtil::LayoutOptimizer layout_opt_;
 
       void get_rseq_opt_layouts(
         std::vector<std::vector<MapperUtil::CompInfo<double> > > &opt_layouts);
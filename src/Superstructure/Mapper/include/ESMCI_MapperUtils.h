@@ -31,4 +31,7 @@
 #include "ESMCI_ExecBlockUtils.h"
 #include "ESMCI_ExecSim.h"
 
+// Profile based PET layout optimizer
+#include "ESMCI_LayoutOptimizer.h"
+
 #endif // ESMCI_MapperUtils_H
@@ -0,0 +1,20 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright 2002-2020, University Corporation for Atmospheric Research, 
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics 
+// Laboratory, University of Michigan, National Centers for Environmental 
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory, 
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+//
+//-----------------------------------------------------------------------------
+// The ESMF Accelerator framework interface
+#ifdef ESMF_ACC_SOFTWARE_STACK
+namespace ESMCI{
+
+int VMAccFwGetNumDevices(void );
+
+}
+#endif
+
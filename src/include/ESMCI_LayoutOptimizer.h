@@ -0,0 +1,176 @@
+#ifndef ESMCI_LayoutOptimizer_H
+#define ESMCI_LayoutOptimizer_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+
+namespace ESMCI{
+  namespace MapperUtil{
+
+    /* The class to store the timing of a region read from an ESMF profile
+     * summary (the ESMF_Profile.summary file written by the Trace subsystem
+     * from its RegionSummary tree). ESMF component phases are named
+     * "[COMP] PHASE" and connector phases "[SRC-TO-DST] PHASE" in the
+     * profile. All times are in seconds
+     */
+    class ProfileRegionInfo{
+      public:
+        ProfileRegionInfo(const std::string &name, int depth, int parent,
+          int npets, int count, double mean_time, double min_time,
+          double max_time);
+        std::string get_name(void ) const;
+        /* Nesting depth of the region, 0 for the outermost regions */
+        int get_depth(void ) const;
+        /* Index of the enclosing region in the list of regions read from
+         * the profile, -1 for the outermost regions
+         */
+        int get_parent(void ) const;
+        /* Number of PETs reporting timings for the region */
+        int get_npets(void ) const;
+        /* Number of times the region was entered on each PET, -1 if the
+         * counts differ between the PETs
+         */
+        int get_count(void ) const;
+        double get_mean_time(void ) const;
+        double get_min_time(void ) const;
+        double get_max_time(void ) const;
+        /* Is this region an ESMF component or connector phase ? */
+        bool is_comp_phase(void ) const;
+        bool is_connector_phase(void ) const;
+        /* The component name and phase name of an ESMF component phase */
+        std::string get_comp_name(void ) const;
+        std::string get_comp_phase_name(void ) const;
+        /* The source and destination component names of a connector
+         * phase, "[SRC-TO-DST] PHASE"
+         */
+        std::string get_connector_src_name(void ) const;
+        std::string get_connector_dst_name(void ) const;
+      private:
+        std::string name_;
+        int depth_;
+        int parent_;
+        int npets_;
+        int count_;
+        double mean_time_;
+        double min_time_;
+        double max_time_;
+        std::string comp_name_;
+        std::string comp_phase_name_;
+    };
+
+    /* Read the region timings from an ESMF profile summary, fname. The
+     * regions are returned in the order they appear in the profile, each
+     * region followed by its nested regions
+     */
+    int ReadProfileSummary(const std::string &fname,
+          std::vector<ProfileRegionInfo> &region_infos);
+
+    /* The layout optimizer class
+     *
+     * The layout optimizer finds a PET layout for a set of model components
+     * from profiled timings of previous runs. The timings of all the phases
+     * of a component are added up, and a scaling curve, t(n) = a + b/n, is
+     * fit to the timings of the component on the different number of PETs
+     * (n) it ran on. The scaling curves are then used to compare running
+     * all the components sequentially on all the PETs with running them
+     * concurrently on disjoint PET ranges. A coupler (connector) cost is
+     * only charged to layouts where the source and destination components
+     * run on disjoint PET ranges, the I/O cost of a component is scaled
+     * with the number of PETs of the component
+     */
+    class LayoutOptimizer{
+      public:
+        typedef enum{
+          LAYOUT_SEQUENTIAL = 1,
+          LAYOUT_CONCURRENT
+        } LayoutKind;
+        LayoutOptimizer();
+        /* Add the timings from the profile summary of a run. Components
+         * that drive other components (e.g. the NUOPC driver) are not
+         * included in the layout. The outermost regions that are not
+         * ESMF phases (user regions) are counted as I/O cost, of the
+         * component whose phase they are nested in
+         */
+        void add_profile(const std::vector<ProfileRegionInfo> &region_infos);
+        int add_profile(const std::string &profile_fname);
+        /* Add the timing, wtime, of a component that ran on npets PETs,
+         * io_wtime of which was spent in I/O
+         */
+        void add_comp_timing(const std::string &comp_name, int npets,
+              double wtime, double io_wtime = 0);
+        /* Add the timing of a connector from src_comp_name to
+         * dst_comp_name in a run
+         */
+        void add_connector_timing(const std::string &src_comp_name,
+              const std::string &dst_comp_name, double wtime);
+        /* Add the coupler and I/O cost of a run that is not attributed to
+         * a component, and end the run
+         */
+        void add_run_cost(double coupler_wtime, double io_wtime);
+        std::vector<std::string> get_comp_names(void ) const;
+        /* The predicted wallclock time for a component on npets PETs */
+        double predict_wtime(const std::string &comp_name, int npets) const;
+        /* Find the best layout of the components on npets PETs. Returns
+         * the component names, their PET ranges and the predicted
+         * wallclock time of the layout
+         */
+        bool optimize(int npets, std::vector<std::string> &comp_names,
+              std::vector<std::pair<int, int> > &pet_ranges,
+              double &pred_wtime);
+        LayoutKind get_layout_kind(void ) const;
+        /* Write the last optimized layout as a petlist configuration,
+         * "COMP_petlist_bounds: start end", for the next run
+         */
+        int write_pet_lists(const std::string &fname) const;
+      private:
+        /* Scaling curve of a component, t(n) = a + b/n */
+        class ScalingCurve{
+          public:
+            ScalingCurve();
+            ScalingCurve(double a, double b);
+            double eval(int npets) const;
+          private:
+            double a_;
+            double b_;
+        };
+        /* Timings of each component, (npets, wtime), excluding I/O */
+        std::map<std::string, std::vector<std::pair<int, double> > >
+          comp_timings_;
+        /* I/O timings of each component, (npets, wtime) */
+        std::map<std::string, std::vector<std::pair<int, double> > >
+          comp_io_timings_;
+        /* Components in the order they were first seen */
+        std::vector<std::string> comp_names_;
+        std::map<std::string, ScalingCurve> scaling_curves_;
+        std::map<std::string, ScalingCurve> io_scaling_curves_;
+        bool scaling_curves_valid_;
+        /* Sum of the timings of each connector, (src, dst) */
+        std::map<std::pair<std::string, std::string>, double>
+          connector_wtime_sums_;
+        double coupler_wtime_sum_;
+        double io_wtime_sum_;
+        int nruns_;
+        LayoutKind opt_layout_kind_;
+        std::vector<std::string> opt_comp_names_;
+        std::vector<std::pair<int, int> > opt_pet_ranges_;
+        double opt_wtime_;
+
+        static ScalingCurve fit_scaling_curve(
+              const std::vector<std::pair<int, double> > &timings);
+        void fit_scaling_curves(void );
+        double get_run_cost_wtime(
+              const std::vector<std::pair<int, int> > &pet_ranges) const;
+        void get_sequential_layout(int npets,
+              std::vector<std::pair<int, int> > &pet_ranges,
+              double &pred_wtime) const;
+        bool get_concurrent_layout(int npets,
+              std::vector<std::pair<int, int> > &pet_ranges,
+              double &pred_wtime) const;
+    };
+
+  } // namespace MapperUtil
+} //namespace ESMCI
+
+#endif // ESMCI_LayoutOptimizer_H
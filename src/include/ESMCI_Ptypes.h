@@ -0,0 +1,26 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright 2002-2020, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+//
+// ESMF Ptypes C++ convenient type definitions for programmers.
+//
+//-----------------------------------------------------------------------------
+//
+
+#ifndef ESMCI_Ptypes_h
+#define ESMCI_Ptypes_h
+
+// Convenient types for ESMC
+namespace ESMCI {
+typedef unsigned char UChar;
+typedef unsigned int  UInt; 
+
+} // namespace
+
+#endif  // ESMCI_Ptypes_h
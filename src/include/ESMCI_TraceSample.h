@@ -0,0 +1,76 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright 2002-2020, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+// Low overhead sampling profiler for fine-grained regions.
+//
+// Region names are interned once into small integer ids.  Each thread
+// owns a fixed-size table of per-region counters and a fixed-size ring
+// of recent events, so entering and exiting a region by id performs no
+// allocation, no hashing, and no locking.  Regions entered by name (user
+// regions of the Trace API) look their id up in a per-thread cache, which
+// costs a hash of the name but takes no lock once the name has been seen
+// by the thread.  Every entry is counted; only every Nth outermost entry
+// of a region is timed, N being the sampling period.
+
+#ifndef ESMCI_TRACESAMPLE_H
+#define ESMCI_TRACESAMPLE_H
+
+#include <stdint.h>
+#include <string>
+
+#define TRACE_SAMPLE_MAX_REGIONS 1024  /* number of distinct region ids */
+#define TRACE_SAMPLE_RING_SIZE   4096  /* events per thread, power of 2 */
+
+#define TRACE_SAMPLE_EXIT  0
+#define TRACE_SAMPLE_ENTER 1
+
+// Intern the region name once per call site and record into the sampler.
+#define ESMCI_SAMPLE_REGION_ENTER(name) \
+  do { static const int _esmci_sample_id = ESMCI::TraceSampleRegionId(name); \
+       ESMCI::TraceSampleEnter(_esmci_sample_id); } while (0)
+#define ESMCI_SAMPLE_REGION_EXIT(name) \
+  do { static const int _esmci_sample_id = ESMCI::TraceSampleRegionId(name); \
+       ESMCI::TraceSampleExit(_esmci_sample_id); } while (0)
+
+namespace ESMCI {
+
+  struct TraceSampleEvent {
+    uint64_t ts;     /* timestamp (ns) */
+    uint32_t id;     /* interned region id */
+    uint32_t kind;   /* TRACE_SAMPLE_ENTER or TRACE_SAMPLE_EXIT */
+  };
+
+  struct TraceSampleStats {
+    uint64_t count;    /* number of (outermost) entries */
+    uint64_t sampled;  /* number of timed entries */
+    uint64_t total;    /* total time of timed entries (ns) */
+    uint64_t min;      /* fastest timed entry (ns) */
+    uint64_t max;      /* slowest timed entry (ns) */
+  };
+
+  void TraceSampleOpen(unsigned period, int *rc);
+  void TraceSampleClose(int *rc);
+  bool TraceSampleIsOn();
+  unsigned TraceSampleGetPeriod();
+
+  int TraceSampleRegionId(const char *name);
+  int TraceSampleRegionIdByName(const std::string &name);
+  std::string TraceSampleRegionName(int id);
+
+  void TraceSampleEnter(int id);
+  void TraceSampleExit(int id);
+
+  void TraceSampleGetStats(int id, TraceSampleStats *stats);
+  int TraceSampleGetEvents(TraceSampleEvent *events, int maxEvents);
+  void TraceSampleReport(bool printToLog, std::string filename, int *rc);
+
+}
+
+#endif
@@ -0,0 +1,21 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright 2002-2020, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+//
+// ESMF Util C++ declaration include file
+//
+//-----------------------------------------------------------------------------
+//
+
+#ifndef ESMC_COORDSYS_H
+#define ESMC_COORDSYS_H
+
+
+
+#endif  // ESMC_COORDSYS_H